@@ -0,0 +1,37 @@
+#include "all_type_variant.hpp"
+
+#include <array>
+
+#include <boost/hana/unpack.hpp>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+static_assert(data_type_of<int32_t> == DataType::Int && data_type_of<int64_t> == DataType::Long &&
+                  data_type_of<float> == DataType::Float && data_type_of<double> == DataType::Double &&
+                  data_type_of<std::string> == DataType::String,
+              "DataType does not match data_types_macro.");
+
+namespace {
+
+const auto TYPE_STRINGS = hana::unpack(detail::type_strings, [](const auto... type_strings) {
+  return std::array<std::string, sizeof...(type_strings)>{type_strings...};
+});
+
+}  // namespace
+
+DataType data_type_from_string(const std::string& type_string) {
+  for (auto index = size_t{0}; index < TYPE_STRINGS.size(); ++index) {
+    if (TYPE_STRINGS[index] == type_string) {
+      return static_cast<DataType>(index);
+    }
+  }
+  Fail("Unknown data type '" + type_string + "'.");
+}
+
+const std::string& data_type_to_string(const DataType data_type) {
+  return TYPE_STRINGS[static_cast<size_t>(data_type)];
+}
+
+}  // namespace opossum
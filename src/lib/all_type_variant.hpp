@@ -1,9 +1,12 @@
 #pragma once
 
 #include <boost/hana/ext/boost/mpl/vector.hpp>
+#include <boost/hana/not_equal.hpp>
 #include <boost/hana/pair.hpp>
 #include <boost/hana/prepend.hpp>
 #include <boost/hana/second.hpp>
+#include <boost/hana/size.hpp>
+#include <boost/hana/take_while.hpp>
 #include <boost/hana/transform.hpp>
 #include <boost/hana/tuple.hpp>
 #include <boost/hana/zip.hpp>
@@ -71,6 +74,21 @@ static constexpr auto data_types = detail::data_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// Data types of columns and segments, in the order of data_types_macro. Prefer it over the type strings whenever a
+// type has to be stored or compared at runtime.
+enum class DataType : uint8_t { Int, Long, Float, Double, String };
+
+// The DataType of the C++ type T, e.g., data_type_of<int64_t> == DataType::Long.
+template <typename T>
+constexpr auto data_type_of =
+    static_cast<DataType>(decltype(hana::size(hana::take_while(types, hana::not_equal.to(hana::type_c<T>))))::value);
+
+// Returns the DataType with the given type string (see type_strings), e.g., DataType::Long for "long".
+DataType data_type_from_string(const std::string& type_string);
+
+// Returns the type string of the given DataType.
+const std::string& data_type_to_string(const DataType data_type);
+
 // Function to check if AllTypeVariant is NULL.
 inline bool variant_is_null(const AllTypeVariant& variant) {
   return (variant.which() == 0);
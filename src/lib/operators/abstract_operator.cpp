@@ -1,5 +1,11 @@
 #include "abstract_operator.hpp"
 
+#include <unordered_map>
+
+#include "scheduler/job_group.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
 namespace opossum {
 
 AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
@@ -16,6 +22,11 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+void AbstractOperator::set_parallel_execution_thresholds(const size_t min_chunk_count, const size_t min_row_count) {
+  _min_parallel_chunk_count = min_chunk_count;
+  _min_parallel_row_count = min_row_count;
+}
+
 std::shared_ptr<const Table> AbstractOperator::_left_input_table() const {
   return _left_input->get_output();
 }
@@ -24,4 +35,92 @@ std::shared_ptr<const Table> AbstractOperator::_right_input_table() const {
   return _right_input->get_output();
 }
 
+std::vector<std::shared_ptr<Chunk>> AbstractOperator::_process_chunks(
+    const Table& table, const std::function<std::shared_ptr<Chunk>(const ChunkID)>& chunk_function) const {
+  const auto chunk_count = table.chunk_count();
+  // Each job writes only its own slot, so that the output keeps the order of the input without synchronization.
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+
+  if (chunk_count >= _min_parallel_chunk_count && table.row_count() >= _min_parallel_row_count) {
+    auto jobs = JobGroup{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.schedule([&, chunk_id] { chunks[chunk_id] = chunk_function(chunk_id); });
+    }
+    jobs.wait();
+  } else {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      chunks[chunk_id] = chunk_function(chunk_id);
+    }
+  }
+
+  std::erase(chunks, nullptr);
+  return chunks;
+}
+
+std::shared_ptr<Table> AbstractOperator::_create_filtered_table(
+    const std::shared_ptr<const Table>& table,
+    const std::function<std::vector<ChunkOffset>(const ChunkID)>& chunk_function) const {
+  const auto output_table = std::make_shared<Table>(table->target_chunk_size());
+  const auto column_count = table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(table->column_name(column_id), table->column_data_type(column_id),
+                                        table->column_nullable(column_id));
+  }
+
+  auto output_chunks = _process_chunks(*table, [&](const ChunkID chunk_id) -> std::shared_ptr<Chunk> {
+    const auto chunk_offsets = chunk_function(chunk_id);
+    return chunk_offsets.empty() ? nullptr : _create_reference_chunk(table, chunk_id, chunk_offsets);
+  });
+  if (output_chunks.empty()) {
+    output_chunks.push_back(_create_reference_chunk(table, ChunkID{0}, {}));
+  }
+  for (const auto& output_chunk : output_chunks) {
+    output_table->emplace_chunk(output_chunk);
+  }
+  return output_table;
+}
+
+std::shared_ptr<Chunk> AbstractOperator::_create_reference_chunk(const std::shared_ptr<const Table>& table,
+                                                                 const ChunkID chunk_id,
+                                                                 const std::vector<ChunkOffset>& chunk_offsets) {
+  const auto column_count = table->column_count();
+  const auto input_chunk = chunk_id < table->chunk_count() ? table->get_chunk(chunk_id) : nullptr;
+  const auto output_chunk = std::make_shared<Chunk>();
+
+  // Position list for segments that are not ReferenceSegments, i.e., that are referenced directly.
+  auto direct_pos_list = std::shared_ptr<PosList>{};
+  // Input ReferenceSegments usually share their position list, so do the output segments.
+  auto dereferenced_pos_lists = std::unordered_map<const PosList*, std::shared_ptr<PosList>>{};
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto input_segment =
+        input_chunk && input_chunk->column_count() > 0 ? input_chunk->get_segment(column_id) : nullptr;
+    if (input_segment && input_segment->segment_type() == SegmentType::Reference) {
+      const auto& reference_segment = static_cast<const ReferenceSegment&>(*input_segment);
+      const auto& input_pos_list = *reference_segment.pos_list();
+      auto& pos_list = dereferenced_pos_lists[&input_pos_list];
+      if (!pos_list) {
+        pos_list = std::make_shared<PosList>();
+        pos_list->reserve(chunk_offsets.size());
+        for (const auto chunk_offset : chunk_offsets) {
+          pos_list->push_back(input_pos_list[chunk_offset]);
+        }
+      }
+      output_chunk->add_segment(std::make_shared<ReferenceSegment>(reference_segment.referenced_table(),
+                                                                   reference_segment.referenced_column_id(), pos_list));
+      continue;
+    }
+
+    if (!direct_pos_list) {
+      direct_pos_list = std::make_shared<PosList>();
+      direct_pos_list->reserve(chunk_offsets.size());
+      for (const auto chunk_offset : chunk_offsets) {
+        direct_pos_list->push_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+    output_chunk->add_segment(std::make_shared<ReferenceSegment>(table, column_id, direct_pos_list));
+  }
+  return output_chunk;
+}
+
 }  // namespace opossum
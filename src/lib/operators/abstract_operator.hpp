@@ -1,11 +1,14 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
+class Chunk;
 class Table;
 
 // AbstractOperator is the abstract super class for all operators. All operators have up to two input tables and one
@@ -18,6 +21,9 @@ class Table;
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
 // Operators shall not be executed twice.
+//
+// Operators that process their input chunk by chunk use _process_chunks, which runs one scheduler job per chunk once
+// the input is large enough to benefit from it (see set_parallel_execution_thresholds).
 
 class AbstractOperator : private Noncopyable {
  public:
@@ -39,6 +45,13 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> left_input() const;
   std::shared_ptr<const AbstractOperator> right_input() const;
 
+  // Inputs with fewer chunks or rows than these thresholds are processed in the calling thread, since scheduling jobs
+  // would cost more than it saves.
+  void set_parallel_execution_thresholds(const size_t min_chunk_count, const size_t min_row_count);
+
+  static constexpr auto DEFAULT_MIN_PARALLEL_CHUNK_COUNT = size_t{2};
+  static constexpr auto DEFAULT_MIN_PARALLEL_ROW_COUNT = size_t{1} << 16;
+
  protected:
   // Abstract method to actually execute the operator execute and get_output are split into two methods to allow for
   // easier asynchronous execution.
@@ -47,6 +60,26 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _left_input_table() const;
   std::shared_ptr<const Table> _right_input_table() const;
 
+  // Calls chunk_function for every chunk of the table and returns the chunks it produced, ordered like the input
+  // chunks. chunk_function returns nullptr for input chunks without output. If the table reaches the thresholds, the
+  // calls happen concurrently on the TaskScheduler, so chunk_function must not modify shared state.
+  std::vector<std::shared_ptr<Chunk>> _process_chunks(
+      const Table& table, const std::function<std::shared_ptr<Chunk>(const ChunkID)>& chunk_function) const;
+
+  // Creates the output of an operator that selects rows of the table, e.g., a scan. chunk_function returns the
+  // matching chunk offsets of a chunk in ascending order and is called via _process_chunks. The output has the columns
+  // of the table and holds one chunk per input chunk with matches. An empty result consists of a single empty chunk,
+  // since operators expect every chunk to hold a segment per column.
+  std::shared_ptr<Table> _create_filtered_table(
+      const std::shared_ptr<const Table>& table,
+      const std::function<std::vector<ChunkOffset>(const ChunkID)>& chunk_function) const;
+
+  // Creates a chunk that references the given positions of a chunk of the table via ReferenceSegments. Input
+  // ReferenceSegments are resolved to the rows they reference instead of creating a chain of ReferenceSegments.
+  static std::shared_ptr<Chunk> _create_reference_chunk(const std::shared_ptr<const Table>& table,
+                                                        const ChunkID chunk_id,
+                                                        const std::vector<ChunkOffset>& chunk_offsets);
+
   // Shared pointers to input operators. Can be nullptr, for example, if an operator is the leaf operator in the query
   // plan or if the operator has only one input operator.
   std::shared_ptr<const AbstractOperator> _left_input;
@@ -54,6 +87,9 @@ class AbstractOperator : private Noncopyable {
 
   // Is nullptr until the operator is executed.
   std::shared_ptr<const Table> _output;
+
+  size_t _min_parallel_chunk_count{DEFAULT_MIN_PARALLEL_CHUNK_COUNT};
+  size_t _min_parallel_row_count{DEFAULT_MIN_PARALLEL_ROW_COUNT};
 };
 
 }  // namespace opossum
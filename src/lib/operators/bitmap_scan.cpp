@@ -0,0 +1,96 @@
+#include "bitmap_scan.hpp"
+
+#include <optional>
+
+#include "resolve_type.hpp"
+#include "storage/index/bitmap_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "type_comparison.hpp"
+
+namespace opossum {
+
+BitmapScan::BitmapScan(const std::shared_ptr<const AbstractOperator>& in,
+                       const std::vector<ColumnPredicate>& predicates, const PredicateConnective connective)
+    : AbstractOperator{in}, _predicates{predicates}, _connective{connective} {
+  Assert(!_predicates.empty(), "BitmapScan needs at least one predicate.");
+}
+
+const std::vector<ColumnPredicate>& BitmapScan::predicates() const {
+  return _predicates;
+}
+
+PredicateConnective BitmapScan::connective() const {
+  return _connective;
+}
+
+std::shared_ptr<const Table> BitmapScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  return _create_filtered_table(input_table, [&](const ChunkID chunk_id) {
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    const auto chunk = input_table->get_chunk(chunk_id);
+    if (chunk->size() == 0) {
+      return chunk_offsets;
+    }
+
+    auto matches = std::optional<RoaringBitmap>{};
+    for (const auto& predicate : _predicates) {
+      const auto statistics = chunk->segment_statistics(predicate.column_id);
+      const auto is_pruned = statistics && statistics->can_prune(predicate.scan_type, predicate.search_value);
+      if (is_pruned && _connective == PredicateConnective::And) {
+        matches = RoaringBitmap{};
+        break;
+      }
+      if (is_pruned) {
+        continue;
+      }
+
+      auto predicate_matches = _scan_predicate(*chunk, predicate);
+      if (!matches) {
+        matches = std::move(predicate_matches);
+      } else if (_connective == PredicateConnective::And) {
+        matches = *matches & predicate_matches;
+      } else {
+        matches = *matches | predicate_matches;
+      }
+
+      if (_connective == PredicateConnective::And && matches->empty()) {
+        break;
+      }
+    }
+
+    if (!matches) {
+      return chunk_offsets;
+    }
+    chunk_offsets.reserve(matches->cardinality());
+    matches->for_each([&](const auto chunk_offset) { chunk_offsets.push_back(chunk_offset); });
+    return chunk_offsets;
+  });
+}
+
+RoaringBitmap BitmapScan::_scan_predicate(const Chunk& chunk, const ColumnPredicate& predicate) const {
+  if (const auto index = chunk.bitmap_index(predicate.column_id)) {
+    return index->bitmap(predicate.scan_type, predicate.search_value);
+  }
+
+  auto matches = RoaringBitmap{};
+  if (variant_is_null(predicate.search_value)) {
+    return matches;
+  }
+  const auto& segment = *chunk.get_segment(predicate.column_id);
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto search_value = type_cast<ColumnDataType>(predicate.search_value);
+    with_comparator(predicate.scan_type, [&](const auto comparator) {
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        if (!position.is_null() && comparator(position.value(), search_value)) {
+          matches.add(position.chunk_offset());
+        }
+      });
+    });
+  });
+  return matches;
+}
+
+}  // namespace opossum
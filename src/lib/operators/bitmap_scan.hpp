@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class Chunk;
+class RoaringBitmap;
+
+// Predicate "value <scan_type> search_value" on a column.
+struct ColumnPredicate {
+  ColumnID column_id;
+  ScanType scan_type;
+  AllTypeVariant search_value;
+};
+
+// How BitmapScan combines its predicates.
+enum class PredicateConnective { And, Or };
+
+// Operator that selects the rows matching all (And) or any (Or) of several predicates, e.g., dashboard filters on a
+// handful of low-cardinality columns. For each chunk, every predicate yields a RoaringBitmap of the matching chunk
+// offsets, which the chunk's BitmapIndex of the column provides without reading the segment (see
+// Table::set_column_bitmap_index). Predicates on columns without a bitmap index scan their segment. The bitmaps are
+// intersected or united, and only the final result is materialized into a position list. NULLs never match. Chunks of
+// ReferenceSegments, e.g., the output of another scan, have no bitmap indexes and scan all predicates.
+class BitmapScan : public AbstractOperator {
+ public:
+  BitmapScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnPredicate>& predicates,
+             const PredicateConnective connective);
+
+  const std::vector<ColumnPredicate>& predicates() const;
+
+  PredicateConnective connective() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Returns the chunk offsets of the rows that match the predicate.
+  RoaringBitmap _scan_predicate(const Chunk& chunk, const ColumnPredicate& predicate) const;
+
+  const std::vector<ColumnPredicate> _predicates;
+  const PredicateConnective _connective;
+};
+
+}  // namespace opossum
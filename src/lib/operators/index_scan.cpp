@@ -0,0 +1,151 @@
+#include "index_scan.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "type_comparison.hpp"
+
+namespace opossum {
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids,
+                     const ScanType scan_type, const std::vector<AllTypeVariant>& search_values)
+    : AbstractOperator{in}, _column_ids{column_ids}, _scan_type{scan_type}, _search_values{search_values} {
+  Assert(!_column_ids.empty() && _column_ids.size() == _search_values.size(),
+         "IndexScan expects one search value per column.");
+}
+
+const std::vector<ColumnID>& IndexScan::column_ids() const {
+  return _column_ids;
+}
+
+ScanType IndexScan::scan_type() const {
+  return _scan_type;
+}
+
+const std::vector<AllTypeVariant>& IndexScan::search_values() const {
+  return _search_values;
+}
+
+std::shared_ptr<const Table> IndexScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  // Comparisons with NULL never match.
+  const auto search_has_null = std::any_of(_search_values.begin(), _search_values.end(), variant_is_null);
+  const auto predicate_count = _column_ids.size();
+
+  // Indexes leave NaN rows out and cannot express NaN search values, as NaN is not ordered against any value. NaN != x
+  // holds, though. Like TableScan, OpNotEquals on a floating-point column and NaN search values thus scan the segments.
+  auto index_may_miss_rows = false;
+  for (auto predicate_index = size_t{0}; predicate_index < predicate_count && !search_has_null; ++predicate_index) {
+    resolve_data_type(input_table->column_data_type(_column_ids[predicate_index]), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      if constexpr (std::is_floating_point_v<ColumnDataType>) {
+        index_may_miss_rows |= _scan_type_of(predicate_index) == ScanType::OpNotEquals ||
+                               is_nan(type_cast<ColumnDataType>(_search_values[predicate_index]));
+      }
+    });
+  }
+
+  return _create_filtered_table(input_table, [&](const ChunkID chunk_id) {
+    auto matches = std::vector<ChunkOffset>{};
+    const auto chunk = input_table->get_chunk(chunk_id);
+    if (search_has_null || chunk->size() == 0) {
+      return matches;
+    }
+    for (auto predicate_index = size_t{0}; predicate_index < predicate_count; ++predicate_index) {
+      const auto statistics = chunk->segment_statistics(_column_ids[predicate_index]);
+      if (statistics && statistics->can_prune(_scan_type_of(predicate_index), _search_values[predicate_index])) {
+        return matches;
+      }
+    }
+
+    const auto indexes = chunk->get_indexes(_column_ids);
+    if (!indexes.empty() && !index_may_miss_rows) {
+      _scan_index(*indexes.front(), matches);
+    } else {
+      _scan_chunk(*chunk, matches);
+    }
+    return matches;
+  });
+}
+
+ScanType IndexScan::_scan_type_of(const size_t predicate_index) const {
+  return predicate_index + 1 < _column_ids.size() ? ScanType::OpEquals : _scan_type;
+}
+
+void IndexScan::_scan_index(const BaseIndex& index, std::vector<ChunkOffset>& matches) const {
+  // The rows matching the equality predicates on all but the last column form the range [prefix_begin, prefix_end).
+  // Within it, rows are ordered by the last column.
+  const auto prefix = std::vector<AllTypeVariant>(_search_values.begin(), _search_values.end() - 1);
+  const auto prefix_begin = prefix.empty() ? index.cbegin() : index.lower_bound(prefix);
+  const auto prefix_end = prefix.empty() ? index.cend() : index.upper_bound(prefix);
+  const auto append_range = [&](const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    matches.insert(matches.end(), begin, end);
+  };
+
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      append_range(index.lower_bound(_search_values), index.upper_bound(_search_values));
+      break;
+    case ScanType::OpNotEquals:
+      append_range(prefix_begin, index.lower_bound(_search_values));
+      append_range(index.upper_bound(_search_values), prefix_end);
+      break;
+    case ScanType::OpLessThan:
+      append_range(prefix_begin, index.lower_bound(_search_values));
+      break;
+    case ScanType::OpLessThanEquals:
+      append_range(prefix_begin, index.upper_bound(_search_values));
+      break;
+    case ScanType::OpGreaterThan:
+      append_range(index.upper_bound(_search_values), prefix_end);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      append_range(index.lower_bound(_search_values), prefix_end);
+      break;
+  }
+
+  // The index orders the positions by value. Emit them in chunk order, like a full scan does.
+  std::sort(matches.begin(), matches.end());
+}
+
+void IndexScan::_scan_chunk(const Chunk& chunk, std::vector<ChunkOffset>& matches) const {
+  const auto predicate_count = _column_ids.size();
+  auto candidates = std::vector<ChunkOffset>{};
+  for (auto predicate_index = size_t{0}; predicate_index < predicate_count; ++predicate_index) {
+    const auto& segment = *chunk.get_segment(_column_ids[predicate_index]);
+
+    // The first predicate checks all rows, the following ones only those that matched so far.
+    std::swap(candidates, matches);
+    matches.clear();
+    resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto search_value = type_cast<ColumnDataType>(_search_values[predicate_index]);
+      with_comparator(_scan_type_of(predicate_index), [&](const auto comparator) {
+        if (predicate_index == 0) {
+          segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+            if (!position.is_null() && comparator(position.value(), search_value)) {
+              matches.push_back(position.chunk_offset());
+            }
+          });
+        } else {
+          segment_iterate_filtered<ColumnDataType>(segment, candidates, [&](const auto& position) {
+            if (!position.is_null() && comparator(position.value(), search_value)) {
+              matches.push_back(candidates[position.chunk_offset()]);
+            }
+          });
+        }
+      });
+    });
+
+    if (matches.empty()) {
+      return;
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class BaseIndex;
+class Chunk;
+
+// Operator that selects the rows satisfying a conjunction of predicates on several columns:
+//
+//   column_ids[0] = search_values[0] AND ... AND column_ids[n - 1] <scan_type> search_values[n - 1]
+//
+// Chunks with an index over exactly these columns (e.g., a CompositeIndex, see Chunk::create_index) answer the whole
+// conjunction with one index probe instead of one scan per predicate and an intersection of the results. Other chunks
+// are scanned column by column, each predicate only checking the rows that satisfied the previous ones. Chunks that
+// segment statistics rule out are skipped. NULLs never match. Chunks of ReferenceSegments, e.g., the output of another
+// scan, have no indexes and are always scanned column by column. Indexes leave NaN rows out, so NaN search values and
+// OpNotEquals on a floating-point column are scanned column by column as well.
+class IndexScan : public AbstractOperator {
+ public:
+  IndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids,
+            const ScanType scan_type, const std::vector<AllTypeVariant>& search_values);
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  ScanType scan_type() const;
+
+  const std::vector<AllTypeVariant>& search_values() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Returns the scan type of the predicate on the nth column.
+  ScanType _scan_type_of(const size_t predicate_index) const;
+
+  // Appends the chunk offsets that match all predicates, in ascending order.
+  void _scan_index(const BaseIndex& index, std::vector<ChunkOffset>& matches) const;
+  void _scan_chunk(const Chunk& chunk, std::vector<ChunkOffset>& matches) const;
+
+  const std::vector<ColumnID> _column_ids;
+  const ScanType _scan_type;
+  const std::vector<AllTypeVariant> _search_values;
+};
+
+}  // namespace opossum
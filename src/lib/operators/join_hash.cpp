@@ -0,0 +1,347 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <map>
+
+#include "resolve_type.hpp"
+#include "scheduler/job_group.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/value_hash.hpp"
+
+namespace opossum {
+
+namespace {
+
+// A non-NULL join value together with its hash and the input row it stems from.
+template <typename T>
+struct Element {
+  uint64_t hash;
+  RowID row_id;
+  T value;
+};
+
+// The elements of one input, ordered by partition. Partition p consists of the elements in [offsets[p],
+// offsets[p + 1]).
+template <typename T>
+struct RadixPartitions {
+  std::vector<Element<T>> elements;
+  std::vector<size_t> offsets;
+};
+
+constexpr auto NO_ELEMENT = std::numeric_limits<size_t>::max();
+
+// Partitions use the upper bits of the hash, so that the hash tables within a partition can use the lower ones.
+size_t partition_of(const uint64_t hash, const size_t radix_bits) {
+  return radix_bits == 0 ? 0 : static_cast<size_t>(hash >> (64 - radix_bits));
+}
+
+// Runs job(0) to job(job_count - 1), as jobs on the TaskScheduler if parallel is set.
+void run_jobs(const size_t job_count, const bool parallel, const std::function<void(const size_t)>& job) {
+  if (!parallel) {
+    for (auto index = size_t{0}; index < job_count; ++index) {
+      job(index);
+    }
+    return;
+  }
+
+  auto jobs = JobGroup{};
+  for (auto index = size_t{0}; index < job_count; ++index) {
+    jobs.schedule([&job, index] { job(index); });
+  }
+  jobs.wait();
+}
+
+// Radix-partitions the non-NULL values of a column in two passes over the chunks: the first one materializes the
+// values and counts them per partition, the second one scatters them to their partition. Within a partition, elements
+// keep the order of the table.
+template <typename T>
+RadixPartitions<T> radix_partition(const Table& table, const ColumnID column_id, const size_t radix_bits,
+                                   const bool parallel) {
+  const auto chunk_count = table.chunk_count();
+  const auto partition_count = size_t{1} << radix_bits;
+
+  auto chunk_elements = std::vector<std::vector<Element<T>>>(chunk_count);
+  auto histograms = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+  run_jobs(chunk_count, parallel, [&](const size_t chunk_index) {
+    const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(chunk_index)};
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk->size() == 0) {
+      return;
+    }
+
+    auto& elements = chunk_elements[chunk_index];
+    auto& histogram = histograms[chunk_index];
+    elements.reserve(chunk->size());
+    segment_iterate<T>(*chunk->get_segment(column_id), [&](const auto& position) {
+      if (position.is_null()) {
+        return;
+      }
+      const auto hash = value_hash(position.value());
+      ++histogram[partition_of(hash, radix_bits)];
+      elements.push_back(Element<T>{hash, RowID{chunk_id, position.chunk_offset()}, position.value()});
+    });
+  });
+
+  // Each chunk writes its elements of a partition behind those of the previous chunks.
+  auto partitions = RadixPartitions<T>{};
+  partitions.offsets.resize(partition_count + 1);
+  auto write_offsets = std::vector<std::vector<size_t>>(chunk_count, std::vector<size_t>(partition_count));
+  auto element_count = size_t{0};
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    partitions.offsets[partition] = element_count;
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+      write_offsets[chunk_index][partition] = element_count;
+      element_count += histograms[chunk_index][partition];
+    }
+  }
+  partitions.offsets[partition_count] = element_count;
+
+  partitions.elements.resize(element_count);
+  run_jobs(chunk_count, parallel, [&](const size_t chunk_index) {
+    auto& write_offset = write_offsets[chunk_index];
+    for (auto& element : chunk_elements[chunk_index]) {
+      partitions.elements[write_offset[partition_of(element.hash, radix_bits)]++] = std::move(element);
+    }
+    chunk_elements[chunk_index] = {};
+  });
+  return partitions;
+}
+
+// Joins one partition of the build side with the same partition of the probe side and appends the row ids of each
+// matching pair to build_matches and probe_matches. The hash table chains the build elements of each bucket: heads
+// holds the first element of a bucket, next the following one.
+template <typename T>
+void build_and_probe(const RadixPartitions<T>& build_partitions, const RadixPartitions<T>& probe_partitions,
+                     const size_t partition, PosList& build_matches, PosList& probe_matches) {
+  const auto build_begin = build_partitions.offsets[partition];
+  const auto build_count = build_partitions.offsets[partition + 1] - build_begin;
+  const auto probe_begin = probe_partitions.offsets[partition];
+  const auto probe_end = probe_partitions.offsets[partition + 1];
+  if (build_count == 0 || probe_begin == probe_end) {
+    return;
+  }
+
+  const auto bucket_mask = std::bit_ceil(build_count * 2) - 1;
+  auto heads = std::vector<size_t>(bucket_mask + 1, NO_ELEMENT);
+  auto next = std::vector<size_t>(build_count);
+  for (auto index = size_t{0}; index < build_count; ++index) {
+    auto& head = heads[build_partitions.elements[build_begin + index].hash & bucket_mask];
+    next[index] = head;
+    head = index;
+  }
+
+  for (auto probe_index = probe_begin; probe_index < probe_end; ++probe_index) {
+    const auto& probe_element = probe_partitions.elements[probe_index];
+    for (auto index = heads[probe_element.hash & bucket_mask]; index != NO_ELEMENT; index = next[index]) {
+      const auto& build_element = build_partitions.elements[build_begin + index];
+      if (build_element.hash == probe_element.hash && build_element.value == probe_element.value) {
+        build_matches.push_back(build_element.row_id);
+        probe_matches.push_back(probe_element.row_id);
+      }
+    }
+  }
+}
+
+// Creates the output segments of one join input. Columns of a table that stores data reference it directly. Columns of
+// a table of ReferenceSegments reference what the input references, so that no chains of ReferenceSegments emerge.
+// Output columns share a position list whenever their input columns share one in every chunk.
+class OutputColumns {
+ public:
+  explicit OutputColumns(const std::shared_ptr<const Table>& table) : _table{table} {
+    const auto column_count = table->column_count();
+    const auto chunk_count = table->chunk_count();
+
+    auto is_reference_table = false;
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk->column_count() > 0) {
+        is_reference_table = chunk->get_segment(ColumnID{0})->segment_type() == SegmentType::Reference;
+        break;
+      }
+    }
+
+    _group_of_column.resize(column_count);
+    if (!is_reference_table) {
+      _pos_lists.resize(1);
+      return;
+    }
+
+    auto groups = std::map<std::vector<const PosList*>, size_t>{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      auto column_pos_lists = std::vector<const PosList*>(chunk_count);
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (chunk->column_count() == 0) {
+          continue;
+        }
+        const auto segment = chunk->get_segment(column_id);
+        Assert(segment->segment_type() == SegmentType::Reference,
+               "Join inputs must consist either only of ReferenceSegments or of none.");
+        const auto& reference_segment = static_cast<const ReferenceSegment&>(*segment);
+        column_pos_lists[chunk_id] = reference_segment.pos_list().get();
+        if (_referenced_tables.size() == column_id) {
+          _referenced_tables.push_back(reference_segment.referenced_table());
+          _referenced_column_ids.push_back(reference_segment.referenced_column_id());
+        }
+      }
+
+      const auto [group_it, inserted] = groups.emplace(std::move(column_pos_lists), _pos_lists.size());
+      if (inserted) {
+        _pos_lists.push_back(group_it->first);
+      }
+      _group_of_column[column_id] = group_it->second;
+    }
+  }
+
+  // Adds the segments that reference the given input rows to the chunk.
+  void add_segments(Chunk& chunk, const PosList& row_ids) const {
+    if (_referenced_tables.empty()) {
+      const auto pos_list = std::make_shared<const PosList>(row_ids);
+      const auto column_count = _table->column_count();
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        chunk.add_segment(std::make_shared<ReferenceSegment>(_table, column_id, pos_list));
+      }
+      return;
+    }
+
+    auto group_pos_lists = std::vector<std::shared_ptr<const PosList>>{};
+    group_pos_lists.reserve(_pos_lists.size());
+    for (const auto& input_pos_lists : _pos_lists) {
+      auto pos_list = std::make_shared<PosList>();
+      pos_list->reserve(row_ids.size());
+      for (const auto row_id : row_ids) {
+        pos_list->push_back((*input_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+      }
+      group_pos_lists.push_back(std::move(pos_list));
+    }
+
+    const auto column_count = _group_of_column.size();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& pos_list = group_pos_lists[_group_of_column[column_id]];
+      const auto& referenced_table = _referenced_tables[column_id];
+      const auto referenced_column_id = _referenced_column_ids[column_id];
+      chunk.add_segment(std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list));
+    }
+  }
+
+ protected:
+  const std::shared_ptr<const Table> _table;
+  // Only set for tables of ReferenceSegments: the referenced column of each column.
+  std::vector<std::shared_ptr<const Table>> _referenced_tables;
+  std::vector<ColumnID> _referenced_column_ids;
+  // Columns are grouped by their input position lists, which _pos_lists holds per group and chunk.
+  std::vector<size_t> _group_of_column;
+  std::vector<std::vector<const PosList*>> _pos_lists;
+};
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
+                   const std::shared_ptr<const AbstractOperator>& right, const ColumnID left_column_id,
+                   const ColumnID right_column_id)
+    : AbstractOperator{left, right}, _left_column_id{left_column_id}, _right_column_id{right_column_id} {}
+
+ColumnID JoinHash::left_column_id() const {
+  return _left_column_id;
+}
+
+ColumnID JoinHash::right_column_id() const {
+  return _right_column_id;
+}
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto left_table = _left_input_table();
+  const auto right_table = _right_input_table();
+  const auto data_type = left_table->column_data_type(_left_column_id);
+  Assert(data_type == right_table->column_data_type(_right_column_id), "Join columns must have the same data type.");
+
+  const auto output_table = std::make_shared<Table>(left_table->target_chunk_size());
+  const auto left_column_count = left_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < left_column_count; ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_data_type(column_id),
+                                        left_table->column_nullable(column_id));
+  }
+  const auto right_column_count = right_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < right_column_count; ++column_id) {
+    auto name = right_table->column_name(column_id);
+    const auto& left_names = left_table->column_names();
+    if (std::find(left_names.begin(), left_names.end(), name) != left_names.end()) {
+      name += "_right";
+    }
+    output_table->add_column_definition(name, right_table->column_data_type(column_id),
+                                        right_table->column_nullable(column_id));
+  }
+
+  const auto left_is_build_side = left_table->row_count() <= right_table->row_count();
+  const auto& build_table = left_is_build_side ? *left_table : *right_table;
+  const auto& probe_table = left_is_build_side ? *right_table : *left_table;
+  const auto build_column_id = left_is_build_side ? _left_column_id : _right_column_id;
+  const auto probe_column_id = left_is_build_side ? _right_column_id : _left_column_id;
+  const auto parallel = build_table.chunk_count() + probe_table.chunk_count() >= _min_parallel_chunk_count &&
+                        build_table.row_count() + probe_table.row_count() >= _min_parallel_row_count;
+
+  auto left_matches = std::vector<PosList>{};
+  auto right_matches = std::vector<PosList>{};
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    // Each build partition holds its elements and a hash table with about two buckets and one link per element.
+    const auto build_size = build_table.row_count() * (sizeof(Element<ColumnDataType>) + 3 * sizeof(size_t));
+    auto radix_bits = size_t{0};
+    while (radix_bits < MAX_RADIX_BITS && (build_size >> radix_bits) > L2_CACHE_SIZE) {
+      ++radix_bits;
+    }
+    if (parallel) {
+      const auto worker_count = std::max(TaskScheduler::get().worker_count(), size_t{1});
+      radix_bits = std::min(std::max(radix_bits, size_t{std::bit_width(worker_count - 1)}), MAX_RADIX_BITS);
+    }
+
+    const auto build_partitions = radix_partition<ColumnDataType>(build_table, build_column_id, radix_bits, parallel);
+    const auto probe_partitions = radix_partition<ColumnDataType>(probe_table, probe_column_id, radix_bits, parallel);
+
+    const auto partition_count = size_t{1} << radix_bits;
+    left_matches.resize(partition_count);
+    right_matches.resize(partition_count);
+    auto& build_matches = left_is_build_side ? left_matches : right_matches;
+    auto& probe_matches = left_is_build_side ? right_matches : left_matches;
+    run_jobs(partition_count, parallel, [&](const size_t partition) {
+      build_and_probe(build_partitions, probe_partitions, partition, build_matches[partition],
+                      probe_matches[partition]);
+    });
+  });
+
+  const auto left_columns = OutputColumns{left_table};
+  const auto right_columns = OutputColumns{right_table};
+  const auto create_chunk = [&](const PosList& left_row_ids, const PosList& right_row_ids) {
+    const auto output_chunk = std::make_shared<Chunk>();
+    left_columns.add_segments(*output_chunk, left_row_ids);
+    right_columns.add_segments(*output_chunk, right_row_ids);
+    return output_chunk;
+  };
+
+  const auto partition_count = left_matches.size();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(partition_count);
+  run_jobs(partition_count, parallel, [&](const size_t partition) {
+    if (!left_matches[partition].empty()) {
+      output_chunks[partition] = create_chunk(left_matches[partition], right_matches[partition]);
+    }
+  });
+  std::erase(output_chunks, nullptr);
+
+  // Operators expect every chunk to hold a segment per column, so an empty result consists of a single empty chunk.
+  if (output_chunks.empty()) {
+    output_chunks.push_back(create_chunk({}, {}));
+  }
+  for (const auto& output_chunk : output_chunks) {
+    output_table->emplace_chunk(output_chunk);
+  }
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Operator that joins two tables on the equality of a column of each table (inner equi-join). NULLs never match. The
+// output holds the columns of the left input followed by those of the right input as ReferenceSegments, i.e., it does
+// not copy any values. A right column whose name also exists in the left input is named "<name>_right".
+//
+// The smaller input is the build side. Both inputs are radix-partitioned on the hash of their join values, with as
+// many partitions as needed for the hash table of a build partition to fit into the L2 cache (and at least one per
+// worker of the TaskScheduler). Each pair of partitions is then built and probed independently, in parallel for large
+// inputs (see AbstractOperator::set_parallel_execution_thresholds). Every partition with matches yields one output
+// chunk, so the order of the output rows is unspecified.
+class JoinHash : public AbstractOperator {
+ public:
+  JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+           const ColumnID left_column_id, const ColumnID right_column_id);
+
+  ColumnID left_column_id() const;
+
+  ColumnID right_column_id() const;
+
+  // Typical L2 cache size of a server core. Partitions are sized to fit into it.
+  static constexpr auto L2_CACHE_SIZE = size_t{1} << 20;
+
+  // More partitions than 2^MAX_RADIX_BITS make the partitioning pass itself thrash the TLB.
+  static constexpr auto MAX_RADIX_BITS = size_t{12};
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _left_column_id;
+  const ColumnID _right_column_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,320 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/alp_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
+#include "value_segment_scan.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Scans a DictionarySegment without decoding any values. The search value is translated once into the range of
+// ValueIDs [begin, end) that satisfy the predicate (for OpNotEquals, the ValueIDs outside of it do), since ValueIDs are
+// ordered like the values they represent. Then, only the ValueIDs of the attribute vector are compared. Ranges that
+// are empty or cover the whole dictionary do not need the comparisons at all. NaN is neither smaller, equal, nor larger
+// than any value: a NaN search value has no ValueIDs, and the ValueID of stored NaNs is only matched by OpNotEquals.
+template <typename T>
+void scan_dictionary_segment(const DictionarySegment<T>& segment, const ScanType scan_type, const T& search_value,
+                             const AbstractSegmentStatistics* statistics, std::vector<ChunkOffset>& matches) {
+  const auto value_count = ValueID{segment.unique_values_count()};
+  const auto null_value_id = segment.null_value_id();
+  // The stored NaN, if any, is the last ValueID and not part of the ordered ValueIDs.
+  const auto ordered_value_count = segment.nan_value_id() == INVALID_VALUE_ID ? value_count : segment.nan_value_id();
+  const auto to_bound = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? ordered_value_count : value_id;
+  };
+  const auto search_is_nan = is_nan(search_value);
+  if (search_is_nan && scan_type != ScanType::OpNotEquals) {
+    return;
+  }
+  // The values equal to the search value have the ValueIDs [lower, upper).
+  const auto lower = search_is_nan ? ordered_value_count : to_bound(segment.lower_bound(search_value));
+  const auto upper = search_is_nan ? ordered_value_count : to_bound(segment.upper_bound(search_value));
+
+  auto begin = ValueID{0};
+  auto end = ordered_value_count;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      begin = lower;
+      end = upper;
+      break;
+    case ScanType::OpNotEquals:
+      // The search value is not in the dictionary, so all non-NULL rows match.
+      if (lower == upper) {
+        end = value_count;
+        break;
+      }
+      begin = lower;
+      end = upper;
+      break;
+    case ScanType::OpLessThan:
+      end = lower;
+      break;
+    case ScanType::OpLessThanEquals:
+      end = upper;
+      break;
+    case ScanType::OpGreaterThan:
+      begin = upper;
+      break;
+    case ScanType::OpGreaterThanEquals:
+      begin = lower;
+      break;
+  }
+  const auto is_negated = scan_type == ScanType::OpNotEquals && lower != upper;
+
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto append_matches = [&](const auto& predicate) {
+    attribute_vector.for_each_block([&](const size_t first_index, const std::span<const ValueID> value_ids) {
+      const auto value_id_count = value_ids.size();
+      for (auto index = size_t{0}; index < value_id_count; ++index) {
+        if (predicate(value_ids[index])) {
+          matches.push_back(static_cast<ChunkOffset>(first_index + index));
+        }
+      }
+    });
+  };
+
+  if (!is_negated && begin >= end) {
+    // No match possible.
+    return;
+  }
+
+  if (!is_negated && begin == 0 && end == value_count) {
+    // All rows match, except for NULLs. Without NULLs, the attribute vector is not read at all.
+    const auto segment_size = segment.size();
+    if (statistics && statistics->null_count() == 0) {
+      matches.resize(segment_size);
+      std::iota(matches.begin(), matches.end(), ChunkOffset{0});
+      return;
+    }
+    append_matches([&](const ValueID value_id) { return value_id != null_value_id; });
+    return;
+  }
+
+  if (is_negated) {
+    append_matches([&](const ValueID value_id) {
+      return (value_id < begin || value_id >= end) && value_id != null_value_id;
+    });
+    return;
+  }
+
+  // A single unsigned comparison checks begin <= value_id < end. NULLs are outside of the range.
+  const auto range_begin = static_cast<ValueID::base_type>(begin);
+  const auto range_size = static_cast<ValueID::base_type>(end) - range_begin;
+  append_matches([&](const ValueID value_id) {
+    return static_cast<ValueID::base_type>(value_id) - range_begin < range_size;
+  });
+}
+
+// Scans a RunLengthSegment run by run: the predicate is evaluated once per run, and a matching run appends the chunk
+// offsets of all of its rows at once. NULL runs never match.
+template <typename T>
+void scan_run_length_segment(const RunLengthSegment<T>& segment, const ScanType scan_type, const T& search_value,
+                             std::vector<ChunkOffset>& matches) {
+  const auto& values = segment.values();
+  const auto& null_values = segment.null_values();
+  const auto& end_positions = segment.end_positions();
+  with_comparator(scan_type, [&](const auto comparator) {
+    auto run_begin = ChunkOffset{0};
+    for (auto run_index = size_t{0}; run_index < end_positions.size(); ++run_index) {
+      const auto run_end = static_cast<ChunkOffset>(end_positions[run_index] + 1);
+      if (!null_values[run_index] && comparator(values[run_index], search_value)) {
+        const auto match_count = matches.size();
+        matches.resize(match_count + (run_end - run_begin));
+        std::iota(matches.begin() + static_cast<std::ptrdiff_t>(match_count), matches.end(), run_begin);
+      }
+      run_begin = run_end;
+    }
+  });
+}
+
+// Scans a segment that decodes block by block (FrameOfReferenceSegment, ALPSegment): each block is decoded into a
+// buffer once and then compared with the SIMD kernels of scan_value_segment. The values of NULL rows are unspecified
+// after decoding, so their matches are removed afterwards.
+template <typename T, typename SegmentClass>
+void scan_block_encoded_segment(const SegmentClass& segment, const ScanType scan_type, const T search_value,
+                                std::vector<ChunkOffset>& matches) {
+  const auto& null_values = segment.null_values();
+  const auto segment_size = segment.size();
+  auto block = std::vector<T>(SegmentClass::BLOCK_SIZE);
+  for (auto block_index = size_t{0}; block_index < segment.block_count(); ++block_index) {
+    const auto first_chunk_offset = static_cast<ChunkOffset>(block_index * SegmentClass::BLOCK_SIZE);
+    const auto value_count = std::min(SegmentClass::BLOCK_SIZE, segment_size - first_chunk_offset);
+    segment.decode_block(block_index, block.data());
+    const auto match_count = matches.size();
+    scan_decoded_values(std::span<const T>{block.data(), value_count}, first_chunk_offset, scan_type, search_value,
+                        matches);
+    if (!null_values.empty()) {
+      const auto block_matches_begin = matches.begin() + static_cast<std::ptrdiff_t>(match_count);
+      matches.erase(std::remove_if(block_matches_begin, matches.end(),
+                                   [&](const ChunkOffset chunk_offset) { return null_values[chunk_offset]; }),
+                    matches.end());
+    }
+  }
+}
+
+// Scans an FSSTSegment for OpEquals or OpNotEquals without decompressing any value. Compression is deterministic, so
+// the search value is compressed once and compared with the compressed bytes of each row.
+void scan_fsst_segment(const FSSTSegment<std::string>& segment, const ScanType scan_type,
+                       const std::string& search_value, std::vector<ChunkOffset>& matches) {
+  DebugAssert(scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals,
+              "Compressed values only preserve equality.");
+  const auto compressed_search_value = segment.compress(search_value);
+  const auto match_if_equal = scan_type == ScanType::OpEquals;
+  const auto segment_size = segment.size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    if (!segment.is_null(chunk_offset) &&
+        (segment.compressed_value(chunk_offset) == compressed_search_value) == match_if_equal) {
+      matches.push_back(chunk_offset);
+    }
+  }
+}
+
+}  // namespace
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator{in}, _column_id{column_id}, _scan_type{scan_type}, _search_value{search_value} {}
+
+ColumnID TableScan::column_id() const {
+  return _column_id;
+}
+
+ScanType TableScan::scan_type() const {
+  return _scan_type;
+}
+
+const AllTypeVariant& TableScan::search_value() const {
+  return _search_value;
+}
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _left_input_table();
+  auto output_table = std::shared_ptr<const Table>{};
+  resolve_data_type(input_table->column_data_type(_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    // Comparisons with NULL never match.
+    const auto search_is_null = variant_is_null(_search_value);
+    const auto search_value = search_is_null ? ColumnDataType{} : type_cast<ColumnDataType>(_search_value);
+
+    output_table = _create_filtered_table(input_table, [&](const ChunkID chunk_id) {
+      auto matches = std::vector<ChunkOffset>{};
+      const auto chunk = input_table->get_chunk(chunk_id);
+      if (search_is_null || chunk->size() == 0) {
+        return matches;
+      }
+      const auto statistics = chunk->segment_statistics(_column_id);
+      if (statistics && statistics->can_prune(_scan_type, _search_value)) {
+        return matches;
+      }
+
+      const auto indexes = chunk->get_indexes({_column_id});
+      const auto segment = chunk->get_segment(_column_id);
+      // Indexes leave NaN rows out of their ranges, but NaN != x holds. OpNotEquals on floating-point columns thus
+      // scans the segment instead. Likewise, the index ranges cannot express a NaN search value.
+      const auto may_miss_nan_rows = std::is_floating_point_v<ColumnDataType> && _scan_type == ScanType::OpNotEquals;
+      if (!indexes.empty() && !may_miss_nan_rows && !is_nan(search_value)) {
+        _scan_index(*indexes.front(), matches);
+        return matches;
+      }
+      if (segment->segment_type() == SegmentType::Dictionary) {
+        scan_dictionary_segment(static_cast<const DictionarySegment<ColumnDataType>&>(*segment), _scan_type,
+                                search_value, statistics.get(), matches);
+        return matches;
+      }
+      if (segment->segment_type() == SegmentType::RunLength) {
+        scan_run_length_segment(static_cast<const RunLengthSegment<ColumnDataType>&>(*segment), _scan_type,
+                                search_value, matches);
+        return matches;
+      }
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        if (segment->segment_type() == SegmentType::Value) {
+          scan_value_segment(static_cast<const ValueSegment<ColumnDataType>&>(*segment), _scan_type, search_value,
+                             matches);
+          return matches;
+        }
+      }
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        const auto is_equality = _scan_type == ScanType::OpEquals || _scan_type == ScanType::OpNotEquals;
+        if (segment->segment_type() == SegmentType::FSST && is_equality) {
+          scan_fsst_segment(static_cast<const FSSTSegment<std::string>&>(*segment), _scan_type, search_value, matches);
+          return matches;
+        }
+      }
+      if constexpr (is_encoding_supported<ColumnDataType>(EncodingType::FrameOfReference)) {
+        if (segment->segment_type() == SegmentType::FrameOfReference) {
+          scan_block_encoded_segment(static_cast<const FrameOfReferenceSegment<ColumnDataType>&>(*segment), _scan_type,
+                                     search_value, matches);
+          return matches;
+        }
+      }
+      if constexpr (is_encoding_supported<ColumnDataType>(EncodingType::ALP)) {
+        if (segment->segment_type() == SegmentType::ALP) {
+          scan_block_encoded_segment(static_cast<const ALPSegment<ColumnDataType>&>(*segment), _scan_type,
+                                     search_value, matches);
+          return matches;
+        }
+      }
+
+      with_comparator(_scan_type, [&](const auto comparator) {
+        segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+          if (!position.is_null() && comparator(position.value(), search_value)) {
+            matches.push_back(position.chunk_offset());
+          }
+        });
+      });
+      return matches;
+    });
+  });
+  return output_table;
+}
+
+void TableScan::_scan_index(const BaseIndex& index, std::vector<ChunkOffset>& matches) const {
+  const auto search_values = std::vector<AllTypeVariant>{_search_value};
+  const auto append_range = [&](const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    matches.insert(matches.end(), begin, end);
+  };
+
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      append_range(index.lower_bound(search_values), index.upper_bound(search_values));
+      break;
+    case ScanType::OpNotEquals:
+      append_range(index.cbegin(), index.lower_bound(search_values));
+      append_range(index.upper_bound(search_values), index.cend());
+      break;
+    case ScanType::OpLessThan:
+      append_range(index.cbegin(), index.lower_bound(search_values));
+      break;
+    case ScanType::OpLessThanEquals:
+      append_range(index.cbegin(), index.upper_bound(search_values));
+      break;
+    case ScanType::OpGreaterThan:
+      append_range(index.upper_bound(search_values), index.cend());
+      break;
+    case ScanType::OpGreaterThanEquals:
+      append_range(index.lower_bound(search_values), index.cend());
+      break;
+  }
+
+  // The index orders the positions by value. Emit them in chunk order, like a full scan does.
+  std::sort(matches.begin(), matches.end());
+}
+
+}  // namespace opossum
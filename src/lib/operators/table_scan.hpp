@@ -1,37 +1,43 @@
 #pragma once
 
 #include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class BaseIndex;
+class Chunk;
+
+// Operator that selects the rows whose value in a given column satisfies "value <scan_type> search_value". NULLs never
+// match. The output references the matching rows via ReferenceSegments, i.e., it does not copy any values. Chunks whose
+// segment statistics show that no row can match are skipped without reading them. Chunks with an index on the column
+// (see Chunk::create_index) are scanned via the index in O(result) instead of reading the whole segment.
+// DictionarySegments are scanned in the ValueID domain: the search value is translated into a ValueID range once per
+// chunk, so that no values are decoded. RunLengthSegments evaluate the predicate once per run. Numeric ValueSegments
+// are scanned with SIMD kernels (see scan_value_segment), as are FrameOfReferenceSegments and ALPSegments, one decoded
+// block at a time.
+// Equality predicates on FSSTSegments compare the compressed values with the compressed search value.
 class TableScan : public AbstractOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const ScanType scan_type,
-            const AllTypeVariant search_value) {
-    // TODO(student) implement it in a source file and change this to a declaration.
-  }
+            const AllTypeVariant search_value);
 
-  ColumnID column_id() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  ColumnID column_id() const;
 
-  ScanType scan_type() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  ScanType scan_type() const;
 
-  const AllTypeVariant& search_value() const {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  const AllTypeVariant& search_value() const;
 
  protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // TODO(student) implement it in a source file and change this to a declaration.
-    Fail("Implementation missing.");
-  }
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // Appends the chunk offsets that match the predicate according to the index, in ascending order.
+  void _scan_index(const BaseIndex& index, std::vector<ChunkOffset>& matches) const;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
 };
 
 }  // namespace opossum
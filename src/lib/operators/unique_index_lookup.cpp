@@ -0,0 +1,43 @@
+#include "unique_index_lookup.hpp"
+
+#include "storage/index/unique_hash_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+UniqueIndexLookup::UniqueIndexLookup(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                                     const AllTypeVariant search_value)
+    : AbstractOperator{in}, _column_id{column_id}, _search_value{search_value} {}
+
+ColumnID UniqueIndexLookup::column_id() const {
+  return _column_id;
+}
+
+const AllTypeVariant& UniqueIndexLookup::search_value() const {
+  return _search_value;
+}
+
+std::shared_ptr<const Table> UniqueIndexLookup::_on_execute() {
+  const auto input_table = _left_input_table();
+  const auto index = input_table->unique_index(_column_id);
+  Assert(index, "Column with ID " + std::to_string(_column_id) + " has no unique index.");
+
+  const auto pos_list = std::make_shared<PosList>();
+  if (const auto row_id = index->find(_search_value)) {
+    pos_list->push_back(*row_id);
+  }
+
+  const auto output_table = std::make_shared<Table>(input_table->target_chunk_size());
+  const auto output_chunk = std::make_shared<Chunk>();
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_data_type(column_id),
+                                        input_table->column_nullable(column_id));
+    output_chunk->add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+  }
+  output_table->emplace_chunk(output_chunk);
+  return output_table;
+}
+
+}  // namespace opossum
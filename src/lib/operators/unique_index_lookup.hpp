@@ -0,0 +1,28 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Operator that selects the row whose value in a given column equals the search value, e.g., a primary key lookup.
+// The column must have a unique index (see Table::add_unique_index), so the lookup is a single hash probe regardless
+// of the table size. The output consists of one chunk that references the matching row, if any, via ReferenceSegments.
+class UniqueIndexLookup : public AbstractOperator {
+ public:
+  UniqueIndexLookup(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                    const AllTypeVariant search_value);
+
+  ColumnID column_id() const;
+
+  const AllTypeVariant& search_value() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const AllTypeVariant _search_value;
+};
+
+}  // namespace opossum
@@ -0,0 +1,255 @@
+#include "value_segment_scan.hpp"
+
+#include <bit>
+#include <type_traits>
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BLOCK_SIZE = size_t{64};
+
+template <ScanType scan_type, typename T>
+bool compare(const T value, const T search_value) {
+  if constexpr (scan_type == ScanType::OpEquals) {
+    return value == search_value;
+  } else if constexpr (scan_type == ScanType::OpNotEquals) {
+    return value != search_value;
+  } else if constexpr (scan_type == ScanType::OpLessThan) {
+    return value < search_value;
+  } else if constexpr (scan_type == ScanType::OpLessThanEquals) {
+    return value <= search_value;
+  } else if constexpr (scan_type == ScanType::OpGreaterThan) {
+    return value > search_value;
+  } else {
+    return value >= search_value;
+  }
+}
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+// Ordered comparisons are false for NaN, the unordered inequality is true, like the C++ operators.
+template <ScanType scan_type>
+constexpr int float_predicate() {
+  if constexpr (scan_type == ScanType::OpEquals) {
+    return _CMP_EQ_OQ;
+  } else if constexpr (scan_type == ScanType::OpNotEquals) {
+    return _CMP_NEQ_UQ;
+  } else if constexpr (scan_type == ScanType::OpLessThan) {
+    return _CMP_LT_OQ;
+  } else if constexpr (scan_type == ScanType::OpLessThanEquals) {
+    return _CMP_LE_OQ;
+  } else if constexpr (scan_type == ScanType::OpGreaterThan) {
+    return _CMP_GT_OQ;
+  } else {
+    return _CMP_GE_OQ;
+  }
+}
+#endif
+
+#if defined(__AVX512F__)
+template <ScanType scan_type>
+constexpr int integer_predicate() {
+  if constexpr (scan_type == ScanType::OpEquals) {
+    return _MM_CMPINT_EQ;
+  } else if constexpr (scan_type == ScanType::OpNotEquals) {
+    return _MM_CMPINT_NE;
+  } else if constexpr (scan_type == ScanType::OpLessThan) {
+    return _MM_CMPINT_LT;
+  } else if constexpr (scan_type == ScanType::OpLessThanEquals) {
+    return _MM_CMPINT_LE;
+  } else if constexpr (scan_type == ScanType::OpGreaterThan) {
+    return _MM_CMPINT_NLE;
+  } else {
+    return _MM_CMPINT_NLT;
+  }
+}
+#endif
+
+// Returns a mask whose bit i is set if values[i] matches, for the BLOCK_SIZE values starting at values.
+template <ScanType scan_type, typename T>
+uint64_t match_mask(const T* values, const T search_value) {
+  auto mask = uint64_t{0};
+#if defined(__AVX512F__)
+  if constexpr (std::is_same_v<T, int32_t>) {
+    const auto search = _mm512_set1_epi32(search_value);
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += 16) {
+      const auto value = _mm512_loadu_si512(values + index);
+      mask |= uint64_t{_mm512_cmp_epi32_mask(value, search, integer_predicate<scan_type>())} << index;
+    }
+    return mask;
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    const auto search = _mm512_set1_epi64(search_value);
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += 8) {
+      const auto value = _mm512_loadu_si512(values + index);
+      mask |= uint64_t{_mm512_cmp_epi64_mask(value, search, integer_predicate<scan_type>())} << index;
+    }
+    return mask;
+  } else if constexpr (std::is_same_v<T, float>) {
+    const auto search = _mm512_set1_ps(search_value);
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += 16) {
+      const auto value = _mm512_loadu_ps(values + index);
+      mask |= uint64_t{_mm512_cmp_ps_mask(value, search, float_predicate<scan_type>())} << index;
+    }
+    return mask;
+  } else if constexpr (std::is_same_v<T, double>) {
+    const auto search = _mm512_set1_pd(search_value);
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += 8) {
+      const auto value = _mm512_loadu_pd(values + index);
+      mask |= uint64_t{_mm512_cmp_pd_mask(value, search, float_predicate<scan_type>())} << index;
+    }
+    return mask;
+  }
+#elif defined(__AVX2__)
+  // AVX2 only compares integers for equality and "greater than". The other predicates swap the operands or negate the
+  // result, which is exact for integers.
+  constexpr auto swap_operands = scan_type == ScanType::OpLessThan || scan_type == ScanType::OpGreaterThanEquals;
+  constexpr auto negate = scan_type == ScanType::OpNotEquals || scan_type == ScanType::OpLessThanEquals ||
+                          scan_type == ScanType::OpGreaterThanEquals;
+  constexpr auto is_equality = scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals;
+  if constexpr (std::is_same_v<T, int32_t>) {
+    const auto search = _mm256_set1_epi32(search_value);
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += 8) {
+      const auto value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+      const auto comparison = is_equality     ? _mm256_cmpeq_epi32(value, search)
+                              : swap_operands ? _mm256_cmpgt_epi32(search, value)
+                                              : _mm256_cmpgt_epi32(value, search);
+      mask |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(comparison))) << index;
+    }
+    return negate ? ~mask : mask;
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    const auto search = _mm256_set1_epi64x(search_value);
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += 4) {
+      const auto value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+      const auto comparison = is_equality     ? _mm256_cmpeq_epi64(value, search)
+                              : swap_operands ? _mm256_cmpgt_epi64(search, value)
+                                              : _mm256_cmpgt_epi64(value, search);
+      mask |= static_cast<uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(comparison))) << index;
+    }
+    return negate ? ~mask : mask;
+  } else if constexpr (std::is_same_v<T, float>) {
+    const auto search = _mm256_set1_ps(search_value);
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += 8) {
+      const auto comparison = _mm256_cmp_ps(_mm256_loadu_ps(values + index), search, float_predicate<scan_type>());
+      mask |= static_cast<uint64_t>(_mm256_movemask_ps(comparison)) << index;
+    }
+    return mask;
+  } else if constexpr (std::is_same_v<T, double>) {
+    const auto search = _mm256_set1_pd(search_value);
+    for (auto index = size_t{0}; index < BLOCK_SIZE; index += 4) {
+      const auto comparison = _mm256_cmp_pd(_mm256_loadu_pd(values + index), search, float_predicate<scan_type>());
+      mask |= static_cast<uint64_t>(_mm256_movemask_pd(comparison)) << index;
+    }
+    return mask;
+  }
+#endif
+  // Branch-free, so that compilers can vectorize it for other instruction sets.
+  for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+    mask |= static_cast<uint64_t>(compare<scan_type>(values[index], search_value)) << index;
+  }
+  return mask;
+}
+
+// Appends first_chunk_offset + i for every set bit i of the mask.
+void append_matches(uint64_t mask, const size_t first_chunk_offset, std::vector<ChunkOffset>& matches) {
+  while (mask != 0) {
+    matches.push_back(static_cast<ChunkOffset>(first_chunk_offset + std::countr_zero(mask)));
+    mask &= mask - 1;
+  }
+}
+
+// Appends first_chunk_offset + i for every i < value_count for which values[i] matches. If null_words is given, its
+// bit i marks values[i] as NULL. first_chunk_offset has to be a multiple of BLOCK_SIZE.
+template <ScanType scan_type, typename T>
+void scan_values(const T* values, const size_t value_count, const uint64_t* null_words, const size_t first_chunk_offset,
+                 const T search_value, std::vector<ChunkOffset>& matches) {
+  static_assert(BLOCK_SIZE == NullBitmap::WORD_BITS, "Each block must correspond to one word of the NULL bitmap.");
+  const auto full_block_count = value_count / BLOCK_SIZE;
+  for (auto block_index = size_t{0}; block_index < full_block_count; ++block_index) {
+    auto mask = match_mask<scan_type>(values + block_index * BLOCK_SIZE, search_value);
+    if (null_words) {
+      mask &= ~null_words[block_index];
+    }
+    append_matches(mask, first_chunk_offset + block_index * BLOCK_SIZE, matches);
+  }
+
+  // The remaining values do not fill a block.
+  const auto tail_begin = full_block_count * BLOCK_SIZE;
+  auto mask = uint64_t{0};
+  for (auto index = tail_begin; index < value_count; ++index) {
+    const auto is_match = compare<scan_type>(values[index], search_value);
+    mask |= static_cast<uint64_t>(is_match) << (index - tail_begin);
+  }
+  if (null_words && tail_begin < value_count) {
+    mask &= ~null_words[full_block_count];
+  }
+  append_matches(mask, first_chunk_offset + tail_begin, matches);
+}
+
+template <typename T>
+void scan_values(const T* values, const size_t value_count, const uint64_t* null_words, const size_t first_chunk_offset,
+                 const ScanType scan_type, const T search_value, std::vector<ChunkOffset>& matches) {
+  DebugAssert(first_chunk_offset % BLOCK_SIZE == 0, "Values have to start at a block boundary.");
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      scan_values<ScanType::OpEquals>(values, value_count, null_words, first_chunk_offset, search_value, matches);
+      return;
+    case ScanType::OpNotEquals:
+      scan_values<ScanType::OpNotEquals>(values, value_count, null_words, first_chunk_offset, search_value, matches);
+      return;
+    case ScanType::OpLessThan:
+      scan_values<ScanType::OpLessThan>(values, value_count, null_words, first_chunk_offset, search_value, matches);
+      return;
+    case ScanType::OpLessThanEquals:
+      scan_values<ScanType::OpLessThanEquals>(values, value_count, null_words, first_chunk_offset, search_value,
+                                              matches);
+      return;
+    case ScanType::OpGreaterThan:
+      scan_values<ScanType::OpGreaterThan>(values, value_count, null_words, first_chunk_offset, search_value, matches);
+      return;
+    case ScanType::OpGreaterThanEquals:
+      scan_values<ScanType::OpGreaterThanEquals>(values, value_count, null_words, first_chunk_offset, search_value,
+                                                 matches);
+      return;
+  }
+  Fail("Unknown scan type.");
+}
+
+}  // namespace
+
+template <typename T>
+void scan_value_segment(const ValueSegment<T>& segment, const ScanType scan_type, const T search_value,
+                        std::vector<ChunkOffset>& matches) {
+  const auto& values = segment.values();
+  const auto* null_words = segment.has_null_values() ? segment.null_values().words().data() : nullptr;
+  scan_values(values.data(), values.size(), null_words, 0, scan_type, search_value, matches);
+}
+
+template <typename T>
+void scan_decoded_values(const std::span<const T> values, const ChunkOffset first_chunk_offset,
+                         const ScanType scan_type, const T search_value, std::vector<ChunkOffset>& matches) {
+  scan_values(values.data(), values.size(), nullptr, first_chunk_offset, scan_type, search_value, matches);
+}
+
+template void scan_value_segment(const ValueSegment<int32_t>&, const ScanType, const int32_t,
+                                 std::vector<ChunkOffset>&);
+template void scan_value_segment(const ValueSegment<int64_t>&, const ScanType, const int64_t,
+                                 std::vector<ChunkOffset>&);
+template void scan_value_segment(const ValueSegment<float>&, const ScanType, const float, std::vector<ChunkOffset>&);
+template void scan_value_segment(const ValueSegment<double>&, const ScanType, const double, std::vector<ChunkOffset>&);
+
+template void scan_decoded_values(const std::span<const int32_t>, const ChunkOffset, const ScanType, const int32_t,
+                                  std::vector<ChunkOffset>&);
+template void scan_decoded_values(const std::span<const int64_t>, const ChunkOffset, const ScanType, const int64_t,
+                                  std::vector<ChunkOffset>&);
+template void scan_decoded_values(const std::span<const float>, const ChunkOffset, const ScanType, const float,
+                                  std::vector<ChunkOffset>&);
+template void scan_decoded_values(const std::span<const double>, const ChunkOffset, const ScanType, const double,
+                                  std::vector<ChunkOffset>&);
+
+}  // namespace opossum
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegment;
+
+// Appends the chunk offsets of all non-NULL rows of a numeric ValueSegment for which "value <scan_type> search_value"
+// holds, in ascending order. The values are compared 64 at a time into a bitmask with SIMD instructions, the NULL
+// bitmap's word for these rows is masked out, and the set bits are compacted into chunk offsets. This avoids the
+// per-row branch and push_back that prevent compilers from vectorizing a row-at-a-time loop.
+//
+// As for the attribute vector decoding (see FixedWidthIntegerVector), the kernels are chosen at compile time: AVX-512
+// or AVX2 if the build targets them (release builds use -march=native), otherwise a scalar loop. Comparisons follow
+// the C++ operators, i.e., NaN only matches OpNotEquals. Defined for int32_t, int64_t, float, and double.
+template <typename T>
+void scan_value_segment(const ValueSegment<T>& segment, const ScanType scan_type, const T search_value,
+                        std::vector<ChunkOffset>& matches);
+
+// Appends first_chunk_offset + i for all values[i] for which "values[i] <scan_type> search_value" holds, using the same
+// kernels as scan_value_segment. This scans blocks of encoded segments once they are decoded (e.g., see
+// FrameOfReferenceSegment::decode_block). NULLs are not known here, the caller has to remove them from the matches.
+// first_chunk_offset has to be a multiple of 64.
+template <typename T>
+void scan_decoded_values(const std::span<const T> values, const ChunkOffset first_chunk_offset,
+                         const ScanType scan_type, const T search_value, std::vector<ChunkOffset>& matches);
+
+}  // namespace opossum
@@ -5,6 +5,15 @@
 #include <boost/hana/size.hpp>
 
 #include "all_type_variant.hpp"
+#include "storage/alp_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -60,13 +69,79 @@ namespace hana = boost::hana;
  *   });
  */
 template <typename Functor>
+void resolve_data_type(const DataType data_type, const Functor& func) {
+  // Unrolled at compile time into a comparison of data_type with each DataType.
+  hana::for_each(types, [&](auto type) {
+    if (data_type_of<typename decltype(type)::type> == data_type) {
+      func(type);
+    }
+  });
+}
+
+// Same as above, but for a type string (see type_strings). Prefer the DataType overload in hot paths, since this one
+// compares strings. Fails for unknown type strings.
+template <typename Functor>
 void resolve_data_type(const std::string& type_string, const Functor& func) {
-  hana::for_each(data_types, [&](auto x) {
-    if (std::string(hana::first(x)) == type_string) {
-      // The + before hana::second - which returns a reference - converts its return value into a value
-      func(+hana::second(x));
+  resolve_data_type(data_type_from_string(type_string), func);
+}
+
+/**
+ * Resolves the concrete class of a segment whose data type is T (e.g., DictionarySegment<T>) by its segment_type()
+ * and passes the segment, cast to that class, on to a generic lambda. Unlike a chain of dynamic_casts, this costs a
+ * single virtual call. Example:
+ *
+ *   resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+ *     using SegmentClass = std::decay_t<decltype(typed_segment)>;
+ *     if constexpr (std::is_same_v<SegmentClass, ValueSegment<T>>) {
+ *       ...
+ *     }
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const AbstractSegment& segment, const Functor& func) {
+  DebugAssert(segment.data_type() == data_type_of<T>, "Segment has a different data type.");
+  switch (segment.segment_type()) {
+    case SegmentType::Value:
+      func(static_cast<const ValueSegment<T>&>(segment));
       return;
-    }
+    case SegmentType::Dictionary:
+      func(static_cast<const DictionarySegment<T>&>(segment));
+      return;
+    case SegmentType::RunLength:
+      func(static_cast<const RunLengthSegment<T>&>(segment));
+      return;
+    case SegmentType::FrameOfReference:
+      if constexpr (is_encoding_supported<T>(EncodingType::FrameOfReference)) {
+        func(static_cast<const FrameOfReferenceSegment<T>&>(segment));
+        return;
+      }
+      break;
+    case SegmentType::FSST:
+      if constexpr (is_encoding_supported<T>(EncodingType::FSST)) {
+        func(static_cast<const FSSTSegment<T>&>(segment));
+        return;
+      }
+      break;
+    case SegmentType::ALP:
+      if constexpr (is_encoding_supported<T>(EncodingType::ALP)) {
+        func(static_cast<const ALPSegment<T>&>(segment));
+        return;
+      }
+      break;
+    case SegmentType::Reference:
+      func(static_cast<const ReferenceSegment&>(segment));
+      return;
+  }
+  Fail("Segment type is not defined for this data type.");
+}
+
+// Resolves both the data type and the concrete class of a segment and calls func(type, typed_segment), where type is
+// a hana::type as in resolve_data_type.
+template <typename Functor>
+void resolve_data_and_segment_type(const AbstractSegment& segment, const Functor& func) {
+  resolve_data_type(segment.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    resolve_segment_type<ColumnDataType>(segment, [&](const auto& typed_segment) { func(type, typed_segment); });
   });
 }
 
@@ -0,0 +1,59 @@
+#include "job_group.hpp"
+
+#include <chrono>
+
+#include "task_scheduler.hpp"
+
+namespace opossum {
+
+JobGroup::~JobGroup() {
+  try {
+    wait();
+  } catch (...) {
+    // Destructors must not throw. Callers that care about failures call wait() themselves.
+  }
+}
+
+void JobGroup::schedule(std::function<void()> job) {
+  {
+    const auto lock = std::lock_guard{_mutex};
+    ++_pending_job_count;
+  }
+  TaskScheduler::get()._schedule({std::move(job), this});
+}
+
+void JobGroup::wait() {
+  auto& scheduler = TaskScheduler::get();
+  auto lock = std::unique_lock{_mutex};
+  while (_pending_job_count > 0) {
+    // Instead of blocking a worker, execute pending tasks of any group. Our own jobs may be among them, and jobs that
+    // wait for nested groups would otherwise deadlock once every worker waits.
+    lock.unlock();
+    const auto executed_task = scheduler._try_execute_task();
+    lock.lock();
+    if (!executed_task) {
+      // Jobs of this group are running elsewhere, but they may still schedule nested jobs, so check again regularly.
+      _finished.wait_for(lock, std::chrono::microseconds{100}, [&] { return _pending_job_count == 0; });
+    }
+  }
+
+  if (_exception) {
+    const auto exception = _exception;
+    _exception = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
+void JobGroup::_finish_job(std::exception_ptr exception) {
+  const auto lock = std::lock_guard{_mutex};
+  if (exception && !_exception) {
+    _exception = exception;
+  }
+  --_pending_job_count;
+  // Notify while holding the mutex: once the waiter observes zero pending jobs, it may destroy the group.
+  if (_pending_job_count == 0) {
+    _finished.notify_all();
+  }
+}
+
+}  // namespace opossum
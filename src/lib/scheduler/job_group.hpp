@@ -0,0 +1,39 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A JobGroup schedules jobs on the TaskScheduler and allows waiting until all of them have finished. Groups can be
+// nested: a job may create its own group and wait for it without blocking a worker, since waiting threads execute
+// pending tasks in the meantime.
+class JobGroup : private Noncopyable {
+ public:
+  JobGroup() = default;
+
+  // Waits for all jobs that are still pending, but drops their exceptions. Call wait() to observe them.
+  ~JobGroup();
+
+  // Schedules the job. The job must stay valid until wait() returns, i.e., captured references are fine.
+  void schedule(std::function<void()> job);
+
+  // Blocks until all scheduled jobs have finished and rethrows the first exception one of them threw.
+  void wait();
+
+ protected:
+  friend class TaskScheduler;
+
+  void _finish_job(std::exception_ptr exception);
+
+  std::mutex _mutex;
+  std::condition_variable _finished;
+  size_t _pending_job_count{0};
+  std::exception_ptr _exception;
+};
+
+}  // namespace opossum
@@ -0,0 +1,167 @@
+#include "task_scheduler.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+#include "job_group.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto NO_WORKER = std::numeric_limits<size_t>::max();
+
+// Id of the worker the current thread runs, NO_WORKER for all other threads.
+thread_local auto current_worker_id = NO_WORKER;
+
+size_t default_worker_count() {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+}  // namespace
+
+TaskScheduler& TaskScheduler::get() {
+  static auto singleton = TaskScheduler{};
+  return singleton;
+}
+
+TaskScheduler::TaskScheduler() {
+  _start(default_worker_count());
+}
+
+TaskScheduler::~TaskScheduler() {
+  _stop();
+}
+
+void TaskScheduler::set_worker_count(const size_t worker_count) {
+  Assert(current_worker_id == NO_WORKER, "Workers cannot be restarted from within a job.");
+  _stop();
+  _start(worker_count);
+}
+
+size_t TaskScheduler::worker_count() const {
+  return _workers.size();
+}
+
+void TaskScheduler::reset() {
+  set_worker_count(default_worker_count());
+}
+
+void TaskScheduler::_start(const size_t worker_count) {
+  _shutdown = false;
+  _workers.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _workers.push_back(std::make_unique<Worker>());
+  }
+  // Start the threads only after all deques exist, since workers steal from each other right away.
+  _threads.reserve(worker_count);
+  for (auto worker_id = size_t{0}; worker_id < worker_count; ++worker_id) {
+    _threads.emplace_back([this, worker_id] { _work(worker_id); });
+  }
+}
+
+void TaskScheduler::_stop() {
+  {
+    const auto lock = std::lock_guard{_sleep_mutex};
+    _shutdown = true;
+  }
+  _wake_up.notify_all();
+  for (auto& thread : _threads) {
+    thread.join();
+  }
+  _threads.clear();
+  _workers.clear();
+}
+
+void TaskScheduler::_schedule(Task task) {
+  if (_workers.empty()) {
+    _execute(task);
+    return;
+  }
+
+  const auto worker_id =
+      current_worker_id != NO_WORKER ? current_worker_id : _next_worker_id++ % _workers.size();
+  auto& worker = *_workers[worker_id];
+  {
+    const auto lock = std::lock_guard{worker.mutex};
+    worker.tasks.push_back(std::move(task));
+  }
+  ++_queued_task_count;
+
+  // Taking the mutex ensures that a worker cannot miss the notification between checking the task count and falling
+  // asleep.
+  {
+    const auto lock = std::lock_guard{_sleep_mutex};
+  }
+  _wake_up.notify_one();
+}
+
+bool TaskScheduler::_try_execute_task() {
+  if (_queued_task_count == 0) {
+    return false;
+  }
+
+  const auto worker_count = _workers.size();
+  auto task = std::optional<Task>{};
+
+  // Workers take their own most recent task first.
+  if (current_worker_id != NO_WORKER) {
+    auto& worker = *_workers[current_worker_id];
+    const auto lock = std::lock_guard{worker.mutex};
+    if (!worker.tasks.empty()) {
+      task = std::move(worker.tasks.back());
+      worker.tasks.pop_back();
+    }
+  }
+
+  // Otherwise, steal the oldest task of another worker, starting with the next one to spread out thieves.
+  const auto first_victim_id = current_worker_id != NO_WORKER ? current_worker_id + 1 : size_t{0};
+  for (auto offset = size_t{0}; !task && offset < worker_count; ++offset) {
+    auto& victim = *_workers[(first_victim_id + offset) % worker_count];
+    const auto lock = std::lock_guard{victim.mutex};
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+    }
+  }
+
+  if (!task) {
+    return false;
+  }
+  --_queued_task_count;
+  _execute(*task);
+  return true;
+}
+
+void TaskScheduler::_work(const size_t worker_id) {
+  current_worker_id = worker_id;
+  while (true) {
+    if (_try_execute_task()) {
+      continue;
+    }
+
+    auto lock = std::unique_lock{_sleep_mutex};
+    _wake_up.wait(lock, [&] { return _shutdown || _queued_task_count > 0; });
+    // Pending tasks are executed before shutting down, so that no job group waits forever.
+    if (_shutdown && _queued_task_count == 0) {
+      break;
+    }
+  }
+  current_worker_id = NO_WORKER;
+}
+
+void TaskScheduler::_execute(Task& task) {
+  auto exception = std::exception_ptr{};
+  try {
+    task.job();
+  } catch (...) {
+    exception = std::current_exception();
+  }
+  // Release the job's captures before the group is told that it finished.
+  task.job = nullptr;
+  task.group->_finish_job(exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class JobGroup;
+
+// The TaskScheduler is a process-wide singleton that executes jobs on a fixed pool of worker threads, one per core by
+// default. Each worker owns a deque of tasks: it takes its own tasks from the back (most recently scheduled first,
+// which keeps nested jobs cache-friendly), while idle workers steal from the front of the other deques. Jobs are not
+// scheduled directly but through a JobGroup, which allows waiting for them.
+class TaskScheduler : private Noncopyable {
+ public:
+  static TaskScheduler& get();
+
+  // Stops the current workers after they have executed all pending tasks and starts worker_count new ones. With zero
+  // workers, jobs are executed immediately by the thread that schedules them, which makes tests deterministic.
+  void set_worker_count(const size_t worker_count);
+
+  size_t worker_count() const;
+
+  // Restores the default number of workers, used especially in tests.
+  void reset();
+
+  TaskScheduler(TaskScheduler&&) = delete;
+
+  ~TaskScheduler();
+
+ protected:
+  friend class JobGroup;
+
+  struct Task {
+    std::function<void()> job;
+    JobGroup* group;
+  };
+
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  TaskScheduler();
+
+  // Queues the task in the deque of the calling worker or, if called from another thread, of the next worker in
+  // round-robin order. Executes it immediately if there are no workers.
+  void _schedule(Task task);
+
+  // Executes a single pending task, preferring those of the calling worker. Returns false if no task was pending.
+  bool _try_execute_task();
+
+  void _start(const size_t worker_count);
+  void _stop();
+  void _work(const size_t worker_id);
+
+  static void _execute(Task& task);
+
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::vector<std::thread> _threads;
+
+  // Workers sleep on the condition variable while no task is queued in any deque.
+  std::mutex _sleep_mutex;
+  std::condition_variable _wake_up;
+  std::atomic<size_t> _queued_task_count{0};
+  bool _shutdown{false};
+
+  std::atomic<size_t> _next_worker_id{0};
+};
+
+}  // namespace opossum
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <span>
+
 #include "types.hpp"
 
 namespace opossum {
@@ -25,6 +29,35 @@ class AbstractAttributeVector : private Noncopyable {
 
   // Returns the width of biggest value id in bytes.
   virtual AttributeVectorWidth width() const = 0;
+
+  // Returns the calculated memory usage.
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // Decodes the value ids in [begin, begin + count) into the caller-provided output buffer, which must hold at least
+  // count elements. This is the preferred way to read many value ids since it costs a single virtual call and bounds
+  // check per range instead of per value.
+  virtual void decode(const size_t begin, const size_t count, ValueID* output) const = 0;
+
+  // Decodes all value ids in blocks of DECODE_BLOCK_SIZE and calls functor(first_index, block) for each block, where
+  // block is a std::span<const ValueID> holding the value ids at positions [first_index, first_index + block.size()).
+  template <typename Functor>
+  void for_each_block(const Functor& functor) const {
+    for_each_block(0, size(), functor);
+  }
+
+  // Same as for_each_block(functor), but only visits the value ids in [begin, end).
+  template <typename Functor>
+  void for_each_block(const size_t begin, const size_t end, const Functor& functor) const {
+    auto block = std::array<ValueID, DECODE_BLOCK_SIZE>{};
+    for (auto block_begin = begin; block_begin < end; block_begin += DECODE_BLOCK_SIZE) {
+      const auto block_size = std::min(DECODE_BLOCK_SIZE, end - block_begin);
+      decode(block_begin, block_size, block.data());
+      functor(block_begin, std::span<const ValueID>{block.data(), block_size});
+    }
+  }
+
+  // Number of value ids decoded per call by for_each_block. Small enough to keep the block in the L1 cache.
+  static constexpr auto DECODE_BLOCK_SIZE = size_t{2048};
 };
 
 }  // namespace opossum
@@ -26,6 +26,12 @@ class AbstractSegment : private Noncopyable {
   // Returns the number of values.
   virtual ChunkOffset size() const = 0;
 
+  // Returns the data type of the values.
+  virtual DataType data_type() const = 0;
+
+  // Returns the concrete segment class, which resolve_segment_type uses to cast without dynamic_cast.
+  virtual SegmentType segment_type() const = 0;
+
   // Returns the calculated memory usage.
   virtual size_t estimate_memory_usage() const = 0;
 };
@@ -0,0 +1,308 @@
+#include "alp_segment.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+#include "bit_packing.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Largest exponent such that 10^exponent is exactly representable in T.
+template <typename T>
+constexpr auto MAX_EXPONENT = std::is_same_v<T, float> ? uint8_t{10} : uint8_t{18};
+
+// Encoded integers have to be exactly representable in T for the decoding multiplication to be exact.
+template <typename T>
+constexpr auto ENCODING_LIMIT = static_cast<T>(int64_t{1} << std::numeric_limits<T>::digits);
+
+// Number of values per block used to choose the exponent and factor of a block.
+constexpr auto SAMPLE_SIZE = ChunkOffset{32};
+
+template <typename T>
+constexpr std::array<T, MAX_EXPONENT<T> + 1> powers_of_ten() {
+  auto powers = std::array<T, MAX_EXPONENT<T> + 1>{};
+  powers[0] = T{1};
+  for (auto exponent = size_t{1}; exponent < powers.size(); ++exponent) {
+    powers[exponent] = powers[exponent - 1] * T{10};
+  }
+  return powers;
+}
+
+template <typename T>
+constexpr std::array<T, MAX_EXPONENT<T> + 1> inverse_powers_of_ten() {
+  auto inverse_powers = powers_of_ten<T>();
+  for (auto& power : inverse_powers) {
+    power = T{1} / power;
+  }
+  return inverse_powers;
+}
+
+template <typename T>
+constexpr auto POWERS_OF_TEN = powers_of_ten<T>();
+
+template <typename T>
+constexpr auto INVERSE_POWERS_OF_TEN = inverse_powers_of_ten<T>();
+
+template <typename T>
+T decode_value(const int64_t encoded_value, const uint8_t exponent, const uint8_t factor) {
+  return static_cast<T>(encoded_value) * POWERS_OF_TEN<T>[factor] * INVERSE_POWERS_OF_TEN<T>[exponent];
+}
+
+// Encodes value as value * 10^exponent / 10^factor. Returns false if the value cannot be restored bit for bit.
+template <typename T>
+bool try_encode_value(const T value, const uint8_t exponent, const uint8_t factor, int64_t& encoded_value) {
+  const auto scaled = value * POWERS_OF_TEN<T>[exponent] * INVERSE_POWERS_OF_TEN<T>[factor];
+  // Also rejects NaN, since comparisons with NaN are false.
+  if (!(std::abs(scaled) < ENCODING_LIMIT<T>)) {
+    return false;
+  }
+  encoded_value = static_cast<int64_t>(std::nearbyint(scaled));
+  using Bits = std::conditional_t<std::is_same_v<T, float>, uint32_t, uint64_t>;
+  return std::bit_cast<Bits>(decode_value<T>(encoded_value, exponent, factor)) == std::bit_cast<Bits>(value);
+}
+
+}  // namespace
+
+template <typename T>
+ALPSegment<T>::ALPSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  _compress(abstract_segment);
+}
+
+template <typename T>
+void ALPSegment<T>::_compress(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  _size = abstract_segment->size();
+
+  auto values = std::vector<T>(_size);
+  auto null_values = std::vector<bool>(_size);
+  auto has_null_values = false;
+  for (auto index = ChunkOffset{0}; index < _size; ++index) {
+    const auto variant = abstract_segment->operator[](index);
+    if (variant_is_null(variant)) {
+      null_values[index] = true;
+      has_null_values = true;
+      continue;
+    }
+    values[index] = type_cast<T>(variant);
+  }
+  if (has_null_values) {
+    _null_values = std::move(null_values);
+  }
+
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_exponents.reserve(block_count);
+  _block_factors.reserve(block_count);
+  _block_minimums.reserve(block_count);
+  _block_bit_widths.reserve(block_count);
+  _block_word_offsets.reserve(block_count);
+  _block_exception_offsets.reserve(block_count + 1);
+  _block_exception_offsets.push_back(0);
+
+  auto encoded_values = std::vector<int64_t>(BLOCK_SIZE);
+  auto is_exception = std::vector<bool>(BLOCK_SIZE);
+  for (auto block_begin = ChunkOffset{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(_size, block_begin + BLOCK_SIZE);
+
+    auto sample = std::vector<T>{};
+    const auto sample_stride = std::max(ChunkOffset{1}, (block_end - block_begin) / SAMPLE_SIZE);
+    for (auto index = block_begin; index < block_end; index += sample_stride) {
+      if (!has_null_values || !_null_values[index]) {
+        sample.push_back(values[index]);
+      }
+    }
+
+    // Choose the exponent and factor that minimize the estimated size of the sample, i.e., the bit-packed integers
+    // plus the exceptions.
+    auto best_exponent = uint8_t{0};
+    auto best_factor = uint8_t{0};
+    auto best_cost = std::numeric_limits<size_t>::max();
+    for (auto exponent = uint8_t{0}; exponent <= MAX_EXPONENT<T>; ++exponent) {
+      for (auto factor = uint8_t{0}; factor <= exponent; ++factor) {
+        auto exception_count = size_t{0};
+        auto minimum = std::numeric_limits<int64_t>::max();
+        auto maximum = std::numeric_limits<int64_t>::min();
+        for (const auto value : sample) {
+          auto encoded_value = int64_t{0};
+          if (!try_encode_value(value, exponent, factor, encoded_value)) {
+            ++exception_count;
+            continue;
+          }
+          minimum = std::min(minimum, encoded_value);
+          maximum = std::max(maximum, encoded_value);
+        }
+        const auto bit_width =
+            minimum > maximum ? size_t{0} : size_t{std::bit_width(static_cast<uint64_t>(maximum) - minimum)};
+        const auto cost = sample.size() * bit_width + exception_count * (sizeof(T) + sizeof(ChunkOffset)) * 8;
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_exponent = exponent;
+          best_factor = factor;
+        }
+      }
+    }
+
+    // Encode the block. NULL values and exceptions are replaced by the block minimum so that they do not widen the
+    // offsets.
+    auto minimum = std::numeric_limits<int64_t>::max();
+    auto maximum = std::numeric_limits<int64_t>::min();
+    for (auto index = block_begin; index < block_end; ++index) {
+      const auto block_offset = index - block_begin;
+      is_exception[block_offset] = false;
+      if (has_null_values && _null_values[index]) {
+        continue;
+      }
+      auto& encoded_value = encoded_values[block_offset];
+      if (!try_encode_value(values[index], best_exponent, best_factor, encoded_value)) {
+        is_exception[block_offset] = true;
+        _exception_positions.push_back(index);
+        _exception_values.push_back(values[index]);
+        continue;
+      }
+      minimum = std::min(minimum, encoded_value);
+      maximum = std::max(maximum, encoded_value);
+    }
+
+    // A block consisting of NULL values and exceptions only.
+    if (minimum > maximum) {
+      minimum = 0;
+      maximum = 0;
+    }
+
+    const auto bit_width = static_cast<uint8_t>(std::bit_width(static_cast<uint64_t>(maximum) - minimum));
+    const auto word_offset = _packed_offsets.size();
+    _packed_offsets.resize(word_offset + packed_word_count(block_end - block_begin, bit_width));
+
+    auto bit_position = size_t{0};
+    for (auto index = block_begin; index < block_end; ++index) {
+      const auto block_offset = index - block_begin;
+      if ((!has_null_values || !_null_values[index]) && !is_exception[block_offset]) {
+        const auto offset = static_cast<uint64_t>(encoded_values[block_offset]) - static_cast<uint64_t>(minimum);
+        pack_bits(_packed_offsets.data() + word_offset, bit_position, offset, bit_width);
+      }
+      bit_position += bit_width;
+    }
+
+    _block_exponents.push_back(best_exponent);
+    _block_factors.push_back(best_factor);
+    _block_minimums.push_back(minimum);
+    _block_bit_widths.push_back(bit_width);
+    _block_word_offsets.push_back(word_offset);
+    _block_exception_offsets.push_back(static_cast<uint32_t>(_exception_positions.size()));
+  }
+}
+
+template <typename T>
+T ALPSegment<T>::_decode(const size_t block_index, const int64_t encoded_value) const {
+  return decode_value<T>(encoded_value, _block_exponents[block_index], _block_factors[block_index]);
+}
+
+template <typename T>
+AllTypeVariant ALPSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto optional = get_typed_value(chunk_offset);
+  if (optional) {
+    return optional.value();
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T ALPSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional = get_typed_value(chunk_offset);
+  Assert(optional, "Value at offset " + std::to_string(chunk_offset) + " is NULL.");
+  return optional.value();
+}
+
+template <typename T>
+std::optional<T> ALPSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  const auto block_index = chunk_offset / BLOCK_SIZE;
+  const auto exceptions_begin = _exception_positions.begin() + _block_exception_offsets[block_index];
+  const auto exceptions_end = _exception_positions.begin() + _block_exception_offsets[block_index + 1];
+  const auto exception = std::lower_bound(exceptions_begin, exceptions_end, chunk_offset);
+  if (exception != exceptions_end && *exception == chunk_offset) {
+    return _exception_values[std::distance(_exception_positions.begin(), exception)];
+  }
+
+  const auto bit_width = _block_bit_widths[block_index];
+  const auto offset = unpack_bits(_packed_offsets.data() + _block_word_offsets[block_index],
+                                  size_t{chunk_offset % BLOCK_SIZE} * bit_width, bit_width);
+  return _decode(block_index, static_cast<int64_t>(static_cast<uint64_t>(_block_minimums[block_index]) + offset));
+}
+
+template <typename T>
+bool ALPSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _size, "Value at offset " + std::to_string(chunk_offset) + " does not exist.");
+  return !_null_values.empty() && _null_values[chunk_offset];
+}
+
+template <typename T>
+const std::vector<bool>& ALPSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+size_t ALPSegment<T>::block_count() const {
+  return _block_minimums.size();
+}
+
+template <typename T>
+size_t ALPSegment<T>::exception_count() const {
+  return _exception_positions.size();
+}
+
+template <typename T>
+void ALPSegment<T>::decode_block(const size_t block_index, T* output) const {
+  Assert(block_index < block_count(), "Block " + std::to_string(block_index) + " does not exist.");
+  const auto block_size = std::min(BLOCK_SIZE, static_cast<ChunkOffset>(_size - block_index * BLOCK_SIZE));
+  const auto minimum = static_cast<uint64_t>(_block_minimums[block_index]);
+  const auto scale = POWERS_OF_TEN<T>[_block_factors[block_index]];
+  const auto inverse_scale = INVERSE_POWERS_OF_TEN<T>[_block_exponents[block_index]];
+  unpack_bits(_packed_offsets.data() + _block_word_offsets[block_index], 0, block_size,
+              _block_bit_widths[block_index],
+              [output, minimum, scale, inverse_scale](const size_t index, const uint64_t offset) {
+                output[index] = static_cast<T>(static_cast<int64_t>(minimum + offset)) * scale * inverse_scale;
+              });
+
+  const auto block_begin = block_index * BLOCK_SIZE;
+  for (auto exception_index = _block_exception_offsets[block_index];
+       exception_index < _block_exception_offsets[block_index + 1]; ++exception_index) {
+    output[_exception_positions[exception_index] - block_begin] = _exception_values[exception_index];
+  }
+}
+
+template <typename T>
+ChunkOffset ALPSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+DataType ALPSegment<T>::data_type() const {
+  return data_type_of<T>;
+}
+
+template <typename T>
+SegmentType ALPSegment<T>::segment_type() const {
+  return SegmentType::ALP;
+}
+
+template <typename T>
+size_t ALPSegment<T>::estimate_memory_usage() const {
+  return sizeof(uint8_t) * (_block_exponents.capacity() + _block_factors.capacity() + _block_bit_widths.capacity()) +
+         sizeof(int64_t) * _block_minimums.capacity() + sizeof(size_t) * _block_word_offsets.capacity() +
+         sizeof(uint64_t) * _packed_offsets.capacity() + sizeof(uint32_t) * _block_exception_offsets.capacity() +
+         sizeof(ChunkOffset) * _exception_positions.capacity() + sizeof(T) * _exception_values.capacity() +
+         (_null_values.capacity() + 7) / 8;
+}
+
+template class ALPSegment<float>;
+template class ALPSegment<double>;
+
+}  // namespace opossum
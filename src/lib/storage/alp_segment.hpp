@@ -0,0 +1,92 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+
+namespace opossum {
+
+// ALPSegment is a specific segment type for float and double columns. Following ALP (Adaptive Lossless
+// floating-Point compression), most real-world floating-point values are decimals with few digits after the decimal
+// point (e.g., 23.45). Such a value is multiplied by 10^exponent (and divided by 10^factor to drop trailing zeros)
+// and stored as an integer. The integers of each block of BLOCK_SIZE rows are frame-of-reference encoded and
+// bit-packed like in FrameOfReferenceSegment. Values that do not survive this round trip bit for bit (e.g., 1/3,
+// NaN, or -0.0) are stored unencoded as exceptions. The exponent and factor are chosen per block from a sample.
+// ALPSegment is only defined for float and double.
+template <typename T>
+class ALPSegment : public AbstractSegment {
+ public:
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                "ALPSegment is only defined for float and double.");
+
+  /**
+   * Creates an ALP segment from a given value segment.
+   */
+  explicit ALPSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns NULL value vector that indicates whether a value is NULL with true at position i. It is empty if the
+  // segment does not contain any NULL values.
+  const std::vector<bool>& null_values() const;
+
+  // Returns the number of blocks.
+  size_t block_count() const;
+
+  // Returns the number of values stored as exceptions.
+  size_t exception_count() const;
+
+  // Decodes all values of the given block into output, which has to hold BLOCK_SIZE values (the last block may hold
+  // fewer values). The integers are unpacked and scaled in a tight loop, exceptions are patched in afterwards. The
+  // values at NULL positions are unspecified.
+  void decode_block(const size_t block_index, T* output) const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  DataType data_type() const final;
+
+  SegmentType segment_type() const final;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+  // Number of rows sharing an exponent, a factor, a minimum, and a bit width.
+  static constexpr auto BLOCK_SIZE = ChunkOffset{1024};
+
+ protected:
+  void _compress(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the decoded value of an encoded integer of the given block.
+  T _decode(const size_t block_index, const int64_t encoded_value) const;
+
+  std::vector<uint8_t> _block_exponents;
+  std::vector<uint8_t> _block_factors;
+  std::vector<int64_t> _block_minimums;
+  std::vector<uint8_t> _block_bit_widths;
+  // Index of the first word of each block in _packed_offsets. Blocks always start at a word boundary.
+  std::vector<size_t> _block_word_offsets;
+  std::vector<uint64_t> _packed_offsets;
+
+  // Exceptions of all blocks, sorted by position. The exceptions of block i are
+  // [_block_exception_offsets[i], _block_exception_offsets[i + 1]).
+  std::vector<uint32_t> _block_exception_offsets;
+  std::vector<ChunkOffset> _exception_positions;
+  std::vector<T> _exception_values;
+
+  std::vector<bool> _null_values;
+  ChunkOffset _size{0};
+};
+
+extern template class ALPSegment<float>;
+extern template class ALPSegment<double>;
+
+}  // namespace opossum
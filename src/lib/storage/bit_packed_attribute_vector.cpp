@@ -0,0 +1,97 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "bit_packing.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto MAX_BIT_WIDTH = uint8_t{32};
+
+ValueID max_value_id(const std::vector<ValueID>& values) {
+  if (values.empty()) {
+    return ValueID{0};
+  }
+  return *std::max_element(values.begin(), values.end());
+}
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const std::vector<ValueID>& values)
+    : BitPackedAttributeVector(values, required_bit_width(max_value_id(values))) {}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const std::vector<ValueID>& values, const uint8_t bit_width)
+    : _size{values.size()}, _bit_width{bit_width} {
+  Assert(bit_width >= 1 && bit_width <= MAX_BIT_WIDTH,
+         "Bit width " + std::to_string(bit_width) + " is not supported by BitPackedAttributeVector.");
+  _mask = bit_mask(bit_width);
+  _words.resize(packed_word_count(values.size(), bit_width));
+
+  auto bit_position = size_t{0};
+  for (const auto value : values) {
+    Assert(value <= _mask, "ValueID " + std::to_string(value) + " is too large for bit width " +
+                               std::to_string(bit_width) + ".");
+    pack_bits(_words.data(), bit_position, value, bit_width);
+    bit_position += bit_width;
+  }
+}
+
+ValueID BitPackedAttributeVector::get(const size_t index) const {
+  Assert(index < size(), "Index " + std::to_string(index) + " is out of range.");
+  return ValueID{static_cast<ValueID::base_type>(unpack_bits(_words.data(), index * _bit_width, _bit_width))};
+}
+
+void BitPackedAttributeVector::set(const size_t index, const ValueID value_id) {
+  Assert(index < size(), "Index " + std::to_string(index) + " is out of range.");
+  Assert(value_id <= _mask, "ValueID " + std::to_string(value_id) + " is too large for bit width " +
+                                std::to_string(_bit_width) + ".");
+  const auto bit_position = index * _bit_width;
+  const auto word_index = bit_position / PACKED_WORD_BITS;
+  const auto shift = bit_position % PACKED_WORD_BITS;
+
+  // Clear the old bits before writing the new value, which may span two words.
+  _words[word_index] = (_words[word_index] & ~(_mask << shift)) | (uint64_t{value_id} << shift);
+  if (shift + _bit_width > PACKED_WORD_BITS) {
+    const auto spilled_bits = PACKED_WORD_BITS - shift;
+    _words[word_index + 1] =
+        (_words[word_index + 1] & ~(_mask >> spilled_bits)) | (uint64_t{value_id} >> spilled_bits);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const {
+  return _size;
+}
+
+AttributeVectorWidth BitPackedAttributeVector::width() const {
+  return static_cast<AttributeVectorWidth>((_bit_width + 7) / 8);
+}
+
+uint8_t BitPackedAttributeVector::bit_width() const {
+  return _bit_width;
+}
+
+void BitPackedAttributeVector::decode(const size_t begin, const size_t count, ValueID* output) const {
+  Assert(begin + count <= size(), "Range [" + std::to_string(begin) + ", " + std::to_string(begin + count) +
+                                      ") is out of range.");
+  unpack_bits(_words.data(), begin, count, _bit_width, [output](const size_t index, const uint64_t value) {
+    output[index] = ValueID{static_cast<ValueID::base_type>(value)};
+  });
+}
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const {
+  return estimate_memory_usage(_size, _bit_width);
+}
+
+size_t BitPackedAttributeVector::estimate_memory_usage(const size_t value_count, const uint8_t bit_width) {
+  return packed_word_count(value_count, bit_width) * sizeof(uint64_t);
+}
+
+uint8_t BitPackedAttributeVector::required_bit_width(const ValueID max_value_id) {
+  return static_cast<uint8_t>(std::max(1u, std::bit_width(max_value_id.t)));
+}
+
+}  // namespace opossum
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_attribute_vector.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores ValueIDs with the minimal number of bits (1 to 32) needed for the largest ValueID.
+// The values are packed back to back into 64-bit words, so a value may span two adjacent words. Compared to
+// FixedWidthIntegerVector, this saves memory whenever the largest ValueID does not exactly fill 8, 16, or 32 bits
+// (e.g., a dictionary with 300 entries needs 9 bits per row instead of 16).
+class BitPackedAttributeVector : public AbstractAttributeVector {
+ public:
+  // Packs the given ValueIDs using the minimal bit width required for the largest ValueID.
+  explicit BitPackedAttributeVector(const std::vector<ValueID>& values);
+
+  // Packs the given ValueIDs using the given bit width. Fails if a ValueID does not fit.
+  BitPackedAttributeVector(const std::vector<ValueID>& values, const uint8_t bit_width);
+
+  ~BitPackedAttributeVector() override = default;
+
+  // Returns the value id at a given position.
+  ValueID get(const size_t index) const override;
+
+  // Sets the value id at a given position. The value id has to fit into the bit width of this vector.
+  void set(const size_t index, const ValueID value_id) override;
+
+  // Returns the number of values.
+  size_t size() const override;
+
+  // Returns the number of bytes needed to hold a single unpacked value id.
+  AttributeVectorWidth width() const override;
+
+  // Returns the number of bits used per value id.
+  uint8_t bit_width() const;
+
+  // Unpacks the value ids in [begin, begin + count) into output. Much faster than calling get() for every position,
+  // since the unpacking loop is specialized for the bit width and does not check bounds per value.
+  void decode(const size_t begin, const size_t count, ValueID* output) const override;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const override;
+
+  // Returns the memory a BitPackedAttributeVector with the given number of values and bit width would occupy.
+  static size_t estimate_memory_usage(const size_t value_count, const uint8_t bit_width);
+
+  // Returns the minimal bit width (at least 1) required to store the given value id.
+  static uint8_t required_bit_width(const ValueID max_value_id);
+
+ protected:
+  // Packed value ids, the first value id starts at the least significant bit of the first word.
+  std::vector<uint64_t> _words;
+  size_t _size;
+  uint8_t _bit_width;
+  uint64_t _mask;
+};
+
+}  // namespace opossum
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace opossum {
+
+/**
+ * Helpers to store unsigned integers of a common bit width (0 to 64) back to back in 64-bit words. The first value
+ * starts at the least significant bit of the first word and a value may span two adjacent words. Used by
+ * BitPackedAttributeVector and the integer-based segment encodings.
+ */
+
+constexpr auto PACKED_WORD_BITS = size_t{64};
+
+// Returns a mask with the lowest bit_width bits set.
+constexpr uint64_t bit_mask(const uint8_t bit_width) {
+  return bit_width >= PACKED_WORD_BITS ? ~uint64_t{0} : (uint64_t{1} << bit_width) - 1;
+}
+
+// Returns the number of words needed to store value_count values of the given bit width.
+constexpr size_t packed_word_count(const size_t value_count, const uint8_t bit_width) {
+  return (value_count * bit_width + PACKED_WORD_BITS - 1) / PACKED_WORD_BITS;
+}
+
+// Writes value to the given bit position. The target bits have to be zero.
+inline void pack_bits(uint64_t* words, const size_t bit_position, const uint64_t value, const uint8_t bit_width) {
+  if (bit_width == 0) {
+    return;
+  }
+  const auto word_index = bit_position / PACKED_WORD_BITS;
+  const auto shift = bit_position % PACKED_WORD_BITS;
+  words[word_index] |= value << shift;
+  if (shift + bit_width > PACKED_WORD_BITS) {
+    words[word_index + 1] |= value >> (PACKED_WORD_BITS - shift);
+  }
+}
+
+// Reads the value at the given bit position.
+inline uint64_t unpack_bits(const uint64_t* words, const size_t bit_position, const uint8_t bit_width) {
+  if (bit_width == 0) {
+    return 0;
+  }
+  const auto word_index = bit_position / PACKED_WORD_BITS;
+  const auto shift = bit_position % PACKED_WORD_BITS;
+  auto value = words[word_index] >> shift;
+  if (shift + bit_width > PACKED_WORD_BITS) {
+    value |= words[word_index + 1] << (PACKED_WORD_BITS - shift);
+  }
+  return value & bit_mask(bit_width);
+}
+
+namespace detail {
+
+// Unpacking loop with a compile-time bit width, which turns all shifts and masks into constants and lets the compiler
+// unroll the loop.
+template <uint8_t BitWidth, typename Functor>
+void unpack_bits_fixed_width(const uint64_t* words, const size_t begin, const size_t count, const Functor& functor) {
+  if constexpr (BitWidth == 0) {
+    for (auto index = size_t{0}; index < count; ++index) {
+      functor(index, uint64_t{0});
+    }
+  } else {
+    constexpr auto mask = bit_mask(BitWidth);
+    auto bit_position = begin * BitWidth;
+    for (auto index = size_t{0}; index < count; ++index) {
+      const auto word_index = bit_position / PACKED_WORD_BITS;
+      const auto shift = bit_position % PACKED_WORD_BITS;
+      auto value = words[word_index] >> shift;
+      if (shift + BitWidth > PACKED_WORD_BITS) {
+        value |= words[word_index + 1] << (PACKED_WORD_BITS - shift);
+      }
+      functor(index, value & mask);
+      bit_position += BitWidth;
+    }
+  }
+}
+
+template <typename Functor, size_t... BitWidths>
+constexpr auto make_unpack_functions(std::index_sequence<BitWidths...> /*bit_widths*/) {
+  using UnpackFunction = void (*)(const uint64_t*, const size_t, const size_t, const Functor&);
+  return std::array<UnpackFunction, sizeof...(BitWidths)>{&unpack_bits_fixed_width<BitWidths, Functor>...};
+}
+
+// unpack_functions<Functor>[bit_width] unpacks values of the given bit width.
+template <typename Functor>
+constexpr auto unpack_functions = make_unpack_functions<Functor>(std::make_index_sequence<PACKED_WORD_BITS + 1>{});
+
+}  // namespace detail
+
+// Unpacks the values at positions [begin, begin + count) and calls functor(index, value) for each of them, where index
+// is relative to begin. Much faster than calling unpack_bits() for each position.
+template <typename Functor>
+void unpack_bits(const uint64_t* words, const size_t begin, const size_t count, const uint8_t bit_width,
+                 const Functor& functor) {
+  detail::unpack_functions<Functor>[bit_width](words, begin, count, functor);
+}
+
+}  // namespace opossum
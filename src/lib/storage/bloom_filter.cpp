@@ -0,0 +1,62 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BLOCK_BITS = BloomFilter::WORDS_PER_BLOCK * 64;
+
+// Odd constants that derive the bit of each word from the same 32 hash bits (as in Parquet's split block filters).
+constexpr auto SALTS = std::array<uint32_t, BloomFilter::WORDS_PER_BLOCK>{
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+}  // namespace
+
+BloomFilter::BloomFilter(const size_t value_count, const size_t bits_per_value)
+    : _blocks(std::max(size_t{1}, (value_count * bits_per_value + BLOCK_BITS - 1) / BLOCK_BITS), Block{}) {}
+
+void BloomFilter::insert(const uint64_t hash) {
+  auto& block = _blocks[_block_index(hash)];
+  const auto mask = _block_mask(hash);
+  for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+    block[word_index] |= mask[word_index];
+  }
+}
+
+bool BloomFilter::may_contain(const uint64_t hash) const {
+  const auto& block = _blocks[_block_index(hash)];
+  const auto mask = _block_mask(hash);
+  auto missing_bits = uint64_t{0};
+  for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+    missing_bits |= mask[word_index] & ~block[word_index];
+  }
+  return missing_bits == 0;
+}
+
+size_t BloomFilter::block_count() const {
+  return _blocks.size();
+}
+
+size_t BloomFilter::estimate_memory_usage() const {
+  return _blocks.size() * sizeof(Block);
+}
+
+size_t BloomFilter::_block_index(const uint64_t hash) const {
+  // Maps the upper 32 bits to [0, block_count) without a division.
+  return static_cast<size_t>(((hash >> 32) * _blocks.size()) >> 32);
+}
+
+BloomFilter::Block BloomFilter::_block_mask(const uint64_t hash) {
+  const auto key = static_cast<uint32_t>(hash);
+  auto mask = Block{};
+  for (auto word_index = size_t{0}; word_index < WORDS_PER_BLOCK; ++word_index) {
+    // The upper six bits of the product select one of the word's 64 bits.
+    const auto bit = static_cast<uint32_t>(key * SALTS[word_index]) >> 26;
+    mask[word_index] = uint64_t{1} << bit;
+  }
+  return mask;
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "utils/value_hash.hpp"
+
+namespace opossum {
+
+// BloomFilter answers whether a value may be contained in a set, with false positives but without false negatives. It
+// is blocked: each value only sets bits within a single 512-bit block (one cache line), one bit in each of the block's
+// eight words. Thus, a lookup touches one cache line, which keeps probing cheap enough to do it for every chunk.
+// The filter works on 64-bit hashes; use value_hash() to hash values consistently for inserts and lookups.
+class BloomFilter {
+ public:
+  // Creates a filter that is sized for the given number of values with roughly bits_per_value bits each. With the
+  // default of ten bits, about one percent of lookups for absent values are false positives.
+  explicit BloomFilter(const size_t value_count, const size_t bits_per_value = 10);
+
+  void insert(const uint64_t hash);
+
+  // Returns false if no value with the given hash was inserted. If it returns true, a value may have been inserted.
+  bool may_contain(const uint64_t hash) const;
+
+  // Returns the number of 512-bit blocks.
+  size_t block_count() const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+  static constexpr auto WORDS_PER_BLOCK = size_t{8};
+
+ protected:
+  using Block = std::array<uint64_t, WORDS_PER_BLOCK>;
+
+  // Returns the block a hash maps to and, for each of its words, the bit to set.
+  size_t _block_index(const uint64_t hash) const;
+  static Block _block_mask(const uint64_t hash);
+
+  std::vector<Block> _blocks;
+};
+
+}  // namespace opossum
@@ -1,6 +1,13 @@
 #include "chunk.hpp"
 #include <memory>
 #include "abstract_segment.hpp"
+#include "index/adaptive_radix_tree_index.hpp"
+#include "index/base_index.hpp"
+#include "index/bitmap_index.hpp"
+#include "index/composite_index.hpp"
+#include "index/group_key_index.hpp"
+#include "resolve_type.hpp"
+#include "segment_statistics.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
@@ -8,20 +15,12 @@ namespace opossum {
 
 namespace {
 // Add a value to a given abstract segment.
-void append_to_segment(const AllTypeVariant& value, const std::shared_ptr<AbstractSegment>& segment) {
-// Test all possible ValueSegment variants.
-#define TRY_APPEND_TYPE(Type)                                                         \
-  if (const auto concrete = std::dynamic_pointer_cast<ValueSegment<Type>>(segment)) { \
-    concrete->append(value);                                                          \
-    return;                                                                           \
-  }
-  TRY_APPEND_TYPE(int32_t)
-  TRY_APPEND_TYPE(int64_t)
-  TRY_APPEND_TYPE(float)
-  TRY_APPEND_TYPE(double)
-  TRY_APPEND_TYPE(std::string)
-#undef TRY_APPEND_TYPE
-  Fail("Datatype not implemented.");
+void append_to_segment(const AllTypeVariant& value, AbstractSegment& segment) {
+  Assert(segment.segment_type() == SegmentType::Value, "Values can only be appended to ValueSegments.");
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    static_cast<ValueSegment<ColumnDataType>&>(segment).append(value);
+  });
 }
 }  // namespace
 
@@ -38,7 +37,7 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   for (auto segment_index = size_t{0}; segment_index < values_size; ++segment_index) {
     const auto column = _chunk_segments[segment_index];
     const auto& value = values[segment_index];
-    append_to_segment(value, column);
+    append_to_segment(value, *column);
   }
 }
 
@@ -47,6 +46,85 @@ std::shared_ptr<AbstractSegment> Chunk::get_segment(const ColumnID column_id) co
   return _chunk_segments[column_id];
 }
 
+void Chunk::set_segment_statistics(std::vector<std::shared_ptr<const AbstractSegmentStatistics>> segment_statistics) {
+  Assert(segment_statistics.size() == _chunk_segments.size(), "Expected statistics for each segment.");
+  _segment_statistics = std::move(segment_statistics);
+}
+
+std::shared_ptr<const AbstractSegmentStatistics> Chunk::segment_statistics(const ColumnID column_id) const {
+  Assert(column_id < _chunk_segments.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  if (_segment_statistics.empty()) {
+    return nullptr;
+  }
+  return _segment_statistics[column_id];
+}
+
+std::vector<std::shared_ptr<const BaseIndex>> Chunk::get_indexes(const std::vector<ColumnID>& column_ids) const {
+  const auto segments = _get_segments_for_ids(column_ids);
+  auto indexes = std::vector<std::shared_ptr<const BaseIndex>>{};
+  for (const auto& index : _indexes) {
+    if (index->is_index_for(segments)) {
+      indexes.push_back(index);
+    }
+  }
+  return indexes;
+}
+
+void Chunk::create_indexes_like(const Chunk& chunk) {
+  Assert(chunk.column_count() == column_count(), "Chunks must have the same columns.");
+  for (const auto& index : chunk._indexes) {
+    auto column_ids = std::vector<ColumnID>{};
+    for (const auto& segment : index->get_indexed_segments()) {
+      const auto segment_iterator = std::find(chunk._chunk_segments.begin(), chunk._chunk_segments.end(), segment);
+      column_ids.push_back(
+          ColumnID{static_cast<ColumnID::base_type>(std::distance(chunk._chunk_segments.begin(), segment_iterator))});
+    }
+
+    switch (index->type()) {
+      case SegmentIndexType::GroupKey:
+        create_index<GroupKeyIndex>(column_ids);
+        break;
+      case SegmentIndexType::AdaptiveRadixTree:
+        create_index<AdaptiveRadixTreeIndex>(column_ids);
+        break;
+      case SegmentIndexType::Composite:
+        create_index<CompositeIndex>(column_ids);
+        break;
+    }
+  }
+}
+
+void Chunk::remove_index(const std::shared_ptr<const BaseIndex>& index) {
+  const auto index_iterator = std::find(_indexes.begin(), _indexes.end(), index);
+  Assert(index_iterator != _indexes.end(), "Index is not attached to this chunk.");
+  _indexes.erase(index_iterator);
+}
+
+std::shared_ptr<const BitmapIndex> Chunk::create_bitmap_index(const ColumnID column_id) {
+  const auto index = std::make_shared<BitmapIndex>(get_segment(column_id));
+  _bitmap_indexes.resize(_chunk_segments.size());
+  _bitmap_indexes[column_id] = index;
+  return index;
+}
+
+std::shared_ptr<const BitmapIndex> Chunk::bitmap_index(const ColumnID column_id) const {
+  Assert(column_id < _chunk_segments.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  if (_bitmap_indexes.empty()) {
+    return nullptr;
+  }
+  return _bitmap_indexes[column_id];
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> Chunk::_get_segments_for_ids(
+    const std::vector<ColumnID>& column_ids) const {
+  auto segments = std::vector<std::shared_ptr<const AbstractSegment>>{};
+  segments.reserve(column_ids.size());
+  for (const auto column_id : column_ids) {
+    segments.push_back(get_segment(column_id));
+  }
+  return segments;
+}
+
 ColumnCount Chunk::column_count() const {
   return ColumnCount(_chunk_segments.size());
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
@@ -8,7 +9,9 @@
 namespace opossum {
 
 class BaseIndex;
+class BitmapIndex;
 class AbstractSegment;
+class AbstractSegmentStatistics;
 
 // A chunk is a horizontal partition of a table. For each column in the table, it holds one segment. The segments
 // across all chunks constitute the column.
@@ -35,9 +38,52 @@ class Chunk : private Noncopyable {
   // Returns the segment at a given position.
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
+  // Sets the statistics of all segments, in column order. Table::compress_chunk computes them once the chunk is
+  // immutable.
+  void set_segment_statistics(std::vector<std::shared_ptr<const AbstractSegmentStatistics>> segment_statistics);
+
+  // Returns the statistics of the segment at a given position, or nullptr if there are none (e.g., for chunks that
+  // are still mutable).
+  std::shared_ptr<const AbstractSegmentStatistics> segment_statistics(const ColumnID column_id) const;
+
+  // Creates an index of type Index over the segments of the given columns and attaches it to the chunk, e.g.,
+  // chunk->create_index<GroupKeyIndex>({ColumnID{0}}). Indexes are meant for immutable chunks.
+  template <typename Index>
+  std::shared_ptr<Index> create_index(const std::vector<ColumnID>& column_ids) {
+    const auto index = std::make_shared<Index>(_get_segments_for_ids(column_ids));
+    _indexes.push_back(index);
+    return index;
+  }
+
+  // Returns the indexes over exactly the given columns, in this order.
+  std::vector<std::shared_ptr<const BaseIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
+
+  // Creates indexes of the same types over the same columns as the indexes of another chunk with the same columns,
+  // e.g., of the chunk whose segments were encoded into this one.
+  void create_indexes_like(const Chunk& chunk);
+
+  // Detaches an index from the chunk.
+  void remove_index(const std::shared_ptr<const BaseIndex>& index);
+
+  // Creates a BitmapIndex over the DictionarySegment of the given column and attaches it to the chunk, replacing an
+  // existing one. Like other indexes, it is meant for immutable chunks.
+  std::shared_ptr<const BitmapIndex> create_bitmap_index(const ColumnID column_id);
+
+  // Returns the BitmapIndex of the given column, or nullptr if there is none.
+  std::shared_ptr<const BitmapIndex> bitmap_index(const ColumnID column_id) const;
+
  protected:
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_segments_for_ids(
+      const std::vector<ColumnID>& column_ids) const;
+
   // Segments of a chunk
   std::vector<std::shared_ptr<AbstractSegment>> _chunk_segments;
+  // Statistics of the segments, empty if the chunk has no statistics
+  std::vector<std::shared_ptr<const AbstractSegmentStatistics>> _segment_statistics;
+  // Indexes over one or more segments
+  std::vector<std::shared_ptr<const BaseIndex>> _indexes;
+  // Bitmap indexes of the segments, empty if the chunk has none
+  std::vector<std::shared_ptr<const BitmapIndex>> _bitmap_indexes;
 };
 
 }  // namespace opossum
@@ -0,0 +1,123 @@
+#include "column_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+AbstractColumnStatistics::AbstractColumnStatistics(const DataType data_type, const uint64_t row_count,
+                                                   const uint64_t null_count, HyperLogLog distinct_values)
+    : _data_type{data_type},
+      _row_count{row_count},
+      _null_count{null_count},
+      _distinct_values{std::move(distinct_values)} {}
+
+DataType AbstractColumnStatistics::data_type() const {
+  return _data_type;
+}
+
+uint64_t AbstractColumnStatistics::row_count() const {
+  return _row_count;
+}
+
+uint64_t AbstractColumnStatistics::null_count() const {
+  return _null_count;
+}
+
+double AbstractColumnStatistics::null_fraction() const {
+  if (_row_count == 0) {
+    return 0.0;
+  }
+  return static_cast<double>(_null_count) / static_cast<double>(_row_count);
+}
+
+uint64_t AbstractColumnStatistics::distinct_count() const {
+  // The estimate may exceed the number of values for tiny columns.
+  return std::min(static_cast<uint64_t>(_distinct_values.estimate()), _row_count - _null_count);
+}
+
+template <typename T>
+ColumnStatistics<T>::ColumnStatistics(const ValueSegment<T>& segment, const size_t max_bin_count)
+    : AbstractColumnStatistics{data_type_of<T>, segment.size(),
+                               segment.has_null_values() ? segment.null_values().null_count() : 0, HyperLogLog{}},
+      _max_bin_count{max_bin_count} {
+  const auto& values = segment.values();
+  const auto* null_values = segment.has_null_values() ? &segment.null_values() : nullptr;
+  const auto segment_size = segment.size();
+
+  auto sorted_values = std::vector<T>{};
+  sorted_values.reserve(segment_size - _null_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    if (null_values && (*null_values)[chunk_offset]) {
+      continue;
+    }
+
+    const auto& value = values[chunk_offset];
+    if constexpr (std::is_floating_point_v<T>) {
+      // NaN cannot be ordered, so it is left out of the histogram.
+      if (std::isnan(value)) {
+        continue;
+      }
+    }
+    sorted_values.push_back(value);
+    _distinct_values.insert(value_hash(value));
+  }
+
+  std::sort(sorted_values.begin(), sorted_values.end());
+  _histogram = EquiDepthHistogram<T>::from_sorted_values(sorted_values, _max_bin_count);
+}
+
+template <typename T>
+ColumnStatistics<T>::ColumnStatistics(const uint64_t row_count, const uint64_t null_count,
+                                      HyperLogLog distinct_values, EquiDepthHistogram<T> histogram,
+                                      const size_t max_bin_count)
+    : AbstractColumnStatistics{data_type_of<T>, row_count, null_count, std::move(distinct_values)},
+      _max_bin_count{max_bin_count},
+      _histogram{std::move(histogram)} {}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  // Comparisons with NULL never match.
+  if (variant_is_null(search_value)) {
+    return 0.0;
+  }
+  return estimate_selectivity(scan_type, type_cast<T>(search_value));
+}
+
+template <typename T>
+double ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const T& search_value) const {
+  if (_row_count == 0) {
+    return 0.0;
+  }
+  const auto selectivity = _histogram.estimate_count(scan_type, search_value) / static_cast<double>(_row_count);
+  return std::clamp(selectivity, 0.0, 1.0);
+}
+
+template <typename T>
+std::shared_ptr<AbstractColumnStatistics> ColumnStatistics<T>::merged(const AbstractColumnStatistics& other) const {
+  Assert(other.data_type() == _data_type, "Cannot merge statistics of columns with different data types.");
+  const auto& other_statistics = static_cast<const ColumnStatistics<T>&>(other);
+
+  auto distinct_values = _distinct_values;
+  distinct_values.merge(other_statistics._distinct_values);
+  auto histogram = EquiDepthHistogram<T>::merge(_histogram, other_statistics._histogram, _max_bin_count);
+  // Values that occur in both inputs are counted twice by the merged bins.
+  histogram.scale_distinct_counts(static_cast<double>(distinct_values.estimate()));
+
+  return std::make_shared<ColumnStatistics<T>>(_row_count + other_statistics._row_count,
+                                               _null_count + other_statistics._null_count, std::move(distinct_values),
+                                               std::move(histogram), _max_bin_count);
+}
+
+template <typename T>
+const EquiDepthHistogram<T>& ColumnStatistics<T>::histogram() const {
+  return _histogram;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "equi_depth_histogram.hpp"
+#include "hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegment;
+
+// AbstractColumnStatistics describe the values of a column (or of one of its segments) for cardinality estimation.
+// Unlike AbstractSegmentStatistics, which decide whether a segment can be skipped, they estimate how many rows match.
+// Statistics of different chunks are merged into those of the whole column without looking at the data again.
+class AbstractColumnStatistics : private Noncopyable {
+ public:
+  virtual ~AbstractColumnStatistics() = default;
+
+  // Returns the estimated fraction of rows, including NULLs, for which "value <scan_type> search_value" holds.
+  virtual double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns statistics that describe the rows of both this and other, which must have the same data type.
+  virtual std::shared_ptr<AbstractColumnStatistics> merged(const AbstractColumnStatistics& other) const = 0;
+
+  DataType data_type() const;
+
+  // Returns the number of rows.
+  uint64_t row_count() const;
+
+  // Returns the number of NULLs.
+  uint64_t null_count() const;
+
+  // Returns the share of NULLs among all rows, or zero if there are no rows.
+  double null_fraction() const;
+
+  // Returns the estimated number of distinct non-NULL values.
+  uint64_t distinct_count() const;
+
+ protected:
+  AbstractColumnStatistics(const DataType data_type, const uint64_t row_count, const uint64_t null_count,
+                           HyperLogLog distinct_values);
+
+  const DataType _data_type;
+  const uint64_t _row_count;
+  const uint64_t _null_count;
+  HyperLogLog _distinct_values;
+};
+
+// Statistics of a column with data type T. Besides the counts, they keep an EquiDepthHistogram of the non-NULL values.
+template <typename T>
+class ColumnStatistics : public AbstractColumnStatistics {
+ public:
+  static constexpr auto DEFAULT_MAX_BIN_COUNT = size_t{64};
+
+  // Computes the statistics of a ValueSegment. Sorts a copy of the values, so this is meant for segments that become
+  // immutable (see Table::compress_chunk).
+  explicit ColumnStatistics(const ValueSegment<T>& segment, const size_t max_bin_count = DEFAULT_MAX_BIN_COUNT);
+
+  ColumnStatistics(const uint64_t row_count, const uint64_t null_count, HyperLogLog distinct_values,
+                   EquiDepthHistogram<T> histogram, const size_t max_bin_count = DEFAULT_MAX_BIN_COUNT);
+
+  double estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+  double estimate_selectivity(const ScanType scan_type, const T& search_value) const;
+
+  std::shared_ptr<AbstractColumnStatistics> merged(const AbstractColumnStatistics& other) const final;
+
+  const EquiDepthHistogram<T>& histogram() const;
+
+ protected:
+  const size_t _max_bin_count;
+  EquiDepthHistogram<T> _histogram;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(ColumnStatistics);
+
+}  // namespace opossum
@@ -1,15 +1,151 @@
 #include "dictionary_segment.hpp"
+#include <algorithm>
+#include <bit>
+#include <optional>
 #include <set>
 
 #include "fixed_width_integer_vector.hpp"
+#include "scheduler/job_group.hpp"
+#include "scheduler/task_scheduler.hpp"
 #include "type_cast.hpp"
+#include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "value_segment.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Minimum number of values per job for sorting in parallel. Below, the cost of scheduling and merging dominates.
+constexpr auto PARALLEL_SORT_MIN_VALUES_PER_JOB = size_t{1} << 17;
+
+// Sorts equally sized partitions of the entries in parallel and then merges adjacent sorted partitions pairwise (again
+// in parallel) until a single sorted range is left. There is one partition per worker of the TaskScheduler.
+template <typename Entry>
+void parallel_sort(std::vector<Entry>& entries) {
+  const auto partition_count =
+      std::min(TaskScheduler::get().worker_count(), entries.size() / PARALLEL_SORT_MIN_VALUES_PER_JOB);
+  if (partition_count <= 1) {
+    std::sort(entries.begin(), entries.end());
+    return;
+  }
+
+  auto bounds = std::vector<size_t>{};
+  for (auto partition = size_t{0}; partition <= partition_count; ++partition) {
+    bounds.push_back(partition * entries.size() / partition_count);
+  }
+
+  auto jobs = JobGroup{};
+  for (auto partition = size_t{0}; partition < partition_count; ++partition) {
+    const auto begin = entries.begin() + static_cast<std::ptrdiff_t>(bounds[partition]);
+    const auto end = entries.begin() + static_cast<std::ptrdiff_t>(bounds[partition + 1]);
+    jobs.schedule([begin, end] { std::sort(begin, end); });
+  }
+  jobs.wait();
+
+  while (bounds.size() > 2) {
+    auto merged_bounds = std::vector<size_t>{};
+    for (auto partition = size_t{0}; partition + 1 < bounds.size(); partition += 2) {
+      merged_bounds.push_back(bounds[partition]);
+      if (partition + 2 < bounds.size()) {
+        const auto begin = entries.begin() + static_cast<std::ptrdiff_t>(bounds[partition]);
+        const auto middle = entries.begin() + static_cast<std::ptrdiff_t>(bounds[partition + 1]);
+        const auto end = entries.begin() + static_cast<std::ptrdiff_t>(bounds[partition + 2]);
+        jobs.schedule([begin, middle, end] { std::inplace_merge(begin, middle, end); });
+      }
+    }
+    merged_bounds.push_back(bounds.back());
+    jobs.wait();
+    bounds = std::move(merged_bounds);
+  }
+}
+
+}  // namespace
+
 template <typename T>
 DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
-  _compress(abstract_segment);
+  if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment)) {
+    _compress(*value_segment);
+  } else {
+    _compress(abstract_segment);
+  }
+}
+
+template <typename T>
+void DictionarySegment<T>::_compress(const ValueSegment<T>& value_segment) {
+  // Sort (value, chunk offset) pairs of all non-NULL values. Strings are sorted as views to avoid copying them.
+  using SortKey = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+  const auto& values = value_segment.values();
+  const auto segment_size = static_cast<ChunkOffset>(values.size());
+  // Segments without NULLs skip the NULL checks entirely.
+  const auto has_null_values = value_segment.has_null_values();
+
+  auto entries = std::vector<std::pair<SortKey, ChunkOffset>>{};
+  entries.reserve(segment_size);
+  if (has_null_values) {
+    const auto& null_values = value_segment.null_values();
+    for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
+      if (!null_values[index]) {
+        entries.emplace_back(values[index], index);
+      }
+    }
+  } else {
+    for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
+      entries.emplace_back(values[index], index);
+    }
+  }
+  // NaNs cannot be sorted, as they are neither smaller, equal, nor larger than any value. They are moved out first.
+  auto nan_offsets = std::vector<ChunkOffset>{};
+  if constexpr (std::is_floating_point_v<T>) {
+    const auto nan_begin =
+        std::partition(entries.begin(), entries.end(), [](const auto& entry) { return !is_nan(entry.first); });
+    for (auto entry = nan_begin; entry != entries.end(); ++entry) {
+      nan_offsets.push_back(entry->second);
+    }
+    entries.erase(nan_begin, entries.end());
+  }
+  parallel_sort(entries);
+
+  // Assign the ValueIDs in a single pass over the sorted values. A new ValueID starts whenever the value changes.
+  auto value_ids = std::vector<ValueID>(segment_size);
+  auto sorted_values = std::vector<T>{};
+  for (const auto& [value, chunk_offset] : entries) {
+    if (sorted_values.empty() || sorted_values.back() != value) {
+      sorted_values.emplace_back(value);
+    }
+    value_ids[chunk_offset] = ValueID{static_cast<ValueID::base_type>(sorted_values.size() - 1)};
+  }
+  if (!nan_offsets.empty()) {
+    // All NaNs share the last dictionary entry.
+    const auto nan_value_id = ValueID{static_cast<ValueID::base_type>(sorted_values.size())};
+    sorted_values.emplace_back(values[nan_offsets.front()]);
+    for (const auto chunk_offset : nan_offsets) {
+      value_ids[chunk_offset] = nan_value_id;
+    }
+  }
+
+  if (has_null_values) {
+    // Only visit the set bits of the NULL bitmap.
+    const auto null_value_id = ValueID{static_cast<ValueID::base_type>(sorted_values.size())};
+    const auto& words = value_segment.null_values().words();
+    for (auto word_index = size_t{0}; word_index < words.size(); ++word_index) {
+      for (auto word = words[word_index]; word != 0; word &= word - 1) {
+        value_ids[word_index * NullBitmap::WORD_BITS + std::countr_zero(word)] = null_value_id;
+      }
+    }
+  }
+
+  _set_dictionary(std::move(sorted_values));
+  _attribute_vector = compress_attribute_vector(value_ids);
+}
+
+template <typename T>
+void DictionarySegment<T>::_set_dictionary(std::vector<T>&& sorted_values) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    _dictionary = StringDictionary{sorted_values};
+  } else {
+    _dictionary = std::move(sorted_values);
+  }
 }
 
 template <typename T>
@@ -21,23 +157,29 @@ void DictionarySegment<T>::_compress(const std::shared_ptr<AbstractSegment>& abs
 template <typename T>
 void DictionarySegment<T>::_create_dictionary(const std::shared_ptr<AbstractSegment>& abstract_segment) {
   auto unique_values = std::set<T>();
+  auto nan_value = std::optional<T>{};
   const auto segment_size = abstract_segment->size();
 
-  // Insert all values into a set.
+  // Insert all values into a set. NaNs would break the ordering of the set and get a single entry at the end instead.
   for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
     const auto variant = abstract_segment->operator[](index);
     if (variant_is_null(variant)) {
       continue;
     }
     const auto typed_value = type_cast<T>(variant);
+    if (is_nan(typed_value)) {
+      nan_value = typed_value;
+      continue;
+    }
     unique_values.insert(typed_value);
   }
 
   // Create the sorted dictionary from set.
-  _dictionary.reserve(unique_values.size());
-  for (const auto& value : unique_values) {
-    _dictionary.push_back(value);
+  auto sorted_values = std::vector<T>(unique_values.begin(), unique_values.end());
+  if (nan_value) {
+    sorted_values.push_back(*nan_value);
   }
+  _set_dictionary(std::move(sorted_values));
 }
 
 template <typename T>
@@ -54,7 +196,7 @@ void DictionarySegment<T>::_create_attribute_vector(const std::shared_ptr<Abstra
       continue;
     }
     const auto typed_value = type_cast<T>(variant);
-    const auto value_id = lower_bound(typed_value);
+    const auto value_id = is_nan(typed_value) ? nan_value_id() : lower_bound(typed_value);
     DebugAssert(value_id != INVALID_VALUE_ID, "Inserted value not in the set of unique values.");
     value_ids.push_back(value_id);
   }
@@ -87,7 +229,7 @@ std::optional<T> DictionarySegment<T>::get_typed_value(const ChunkOffset chunk_o
 }
 
 template <typename T>
-const std::vector<T>& DictionarySegment<T>::dictionary() const {
+const typename DictionarySegment<T>::Dictionary& DictionarySegment<T>::dictionary() const {
   return _dictionary;
 }
 
@@ -102,18 +244,35 @@ ValueID DictionarySegment<T>::null_value_id() const {
 }
 
 template <typename T>
-const T DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {;
+ValueID DictionarySegment<T>::nan_value_id() const {
+  if constexpr (std::is_floating_point_v<T>) {
+    if (!dictionary().empty() && is_nan(dictionary().back())) {
+      return ValueID{static_cast<ValueID::base_type>(dictionary().size() - 1)};
+    }
+  }
+  return INVALID_VALUE_ID;
+}
+
+template <typename T>
+const T DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
   DebugAssert(value_id < dictionary().size(), "ValueID " + std::to_string(value_id) + " is out of range.");
   return dictionary()[value_id];
 }
 
 template <typename T>
 ValueID DictionarySegment<T>::lower_bound(const T value) const {
-  const auto it = std::lower_bound(dictionary().begin(), dictionary().end(), value);
-  if (it == dictionary().end()) {
-    return INVALID_VALUE_ID;
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto value_id = dictionary().lower_bound(value);
+    return value_id == dictionary().size() ? INVALID_VALUE_ID : value_id;
+  } else {
+    // NaN, if stored, is behind the ordered values.
+    const auto ordered_end = nan_value_id() == INVALID_VALUE_ID ? dictionary().end() : dictionary().end() - 1;
+    const auto it = is_nan(value) ? ordered_end : std::lower_bound(dictionary().begin(), ordered_end, value);
+    if (it == ordered_end) {
+      return INVALID_VALUE_ID;
+    }
+    return ValueID(std::distance(dictionary().begin(), it));
   }
-  return ValueID(std::distance(dictionary().begin(), it));
 }
 
 template <typename T>
@@ -123,11 +282,18 @@ ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
 
 template <typename T>
 ValueID DictionarySegment<T>::upper_bound(const T value) const {
-  const auto it = std::upper_bound(dictionary().begin(), dictionary().end(), value);
-  if (it == dictionary().end()) {
-    return INVALID_VALUE_ID;
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto value_id = dictionary().upper_bound(value);
+    return value_id == dictionary().size() ? INVALID_VALUE_ID : value_id;
+  } else {
+    // NaN, if stored, is behind the ordered values.
+    const auto ordered_end = nan_value_id() == INVALID_VALUE_ID ? dictionary().end() : dictionary().end() - 1;
+    const auto it = is_nan(value) ? ordered_end : std::upper_bound(dictionary().begin(), ordered_end, value);
+    if (it == ordered_end) {
+      return INVALID_VALUE_ID;
+    }
+    return ValueID(std::distance(dictionary().begin(), it));
   }
-  return ValueID(std::distance(dictionary().begin(), it));
 }
 
 template <typename T>
@@ -145,9 +311,23 @@ ChunkOffset DictionarySegment<T>::size() const {
   return ChunkOffset(attribute_vector()->size());
 }
 
+template <typename T>
+DataType DictionarySegment<T>::data_type() const {
+  return data_type_of<T>;
+}
+
+template <typename T>
+SegmentType DictionarySegment<T>::segment_type() const {
+  return SegmentType::Dictionary;
+}
+
 template <typename T>
 size_t DictionarySegment<T>::estimate_memory_usage() const {
-  return sizeof(T) * dictionary().capacity() + attribute_vector()->width() * size();
+  if constexpr (std::is_same_v<T, std::string>) {
+    return dictionary().estimate_memory_usage() + attribute_vector()->estimate_memory_usage();
+  } else {
+    return sizeof(T) * dictionary().capacity() + attribute_vector()->estimate_memory_usage();
+  }
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(DictionarySegment);
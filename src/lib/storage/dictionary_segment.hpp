@@ -1,17 +1,26 @@
 #pragma once
 
 #include "abstract_segment.hpp"
+#include "string_dictionary.hpp"
 
 namespace opossum {
 
 class AbstractAttributeVector;
 
-// Dictionary is a specific segment type that stores all its values in a vector.
+template <typename T>
+class ValueSegment;
+
+// Dictionary is a specific segment type that stores all its values in a vector. String dictionaries are stored in a
+// contiguous, optionally front-coded StringDictionary instead of a vector of individually allocated strings. NaN is
+// not ordered against any value, so all NaNs of a floating-point segment share a single entry behind the sorted values.
 template <typename T>
 class DictionarySegment : public AbstractSegment {
  public:
+  using Dictionary = std::conditional_t<std::is_same_v<T, std::string>, StringDictionary, std::vector<T>>;
+
   /**
-   * Creates a Dictionary segment from a given value segment.
+   * Creates a Dictionary segment from a given value segment. ValueSegment<T> inputs take a typed fast path that sorts
+   * the values directly (in parallel for large segments), other segments are read via operator[].
    */
   explicit DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
 
@@ -25,7 +34,7 @@ class DictionarySegment : public AbstractSegment {
   std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
 
   // Returns an underlying dictionary.
-  const std::vector<T>& dictionary() const;
+  const Dictionary& dictionary() const;
 
   // Returns an underlying data structure.
   std::shared_ptr<const AbstractAttributeVector> attribute_vector() const;
@@ -33,11 +42,16 @@ class DictionarySegment : public AbstractSegment {
   // Returns the ValueID used to represent a NULL value.
   ValueID null_value_id() const;
 
+  // Returns the ValueID used to represent NaN, i.e., the last dictionary entry. Returns INVALID_VALUE_ID if the segment
+  // stores no NaN. The ValueIDs before it are ordered like their values.
+  ValueID nan_value_id() const;
+
   // Returns the value represented by a given ValueID.
   const T value_of_value_id(const ValueID value_id) const;
 
   // Returns the first value ID that refers to a value >= the search value. Returns INVALID_VALUE_ID if all values are
-  // smaller than the search value.
+  // smaller than the search value. The bounds never refer to NaN, and the bounds of a NaN search value are
+  // INVALID_VALUE_ID.
   ValueID lower_bound(const T value) const;
 
   // Same as lower_bound(T), but accepts an AllTypeVariant.
@@ -56,14 +70,20 @@ class DictionarySegment : public AbstractSegment {
   // Returns the number of entries.
   ChunkOffset size() const override;
 
+  DataType data_type() const final;
+
+  SegmentType segment_type() const final;
+
   // Returns the calculated memory usage.
   size_t estimate_memory_usage() const final;
 
  protected:
   void _compress(const std::shared_ptr<AbstractSegment>& abstract_segment);
+  void _compress(const ValueSegment<T>& value_segment);
+  void _set_dictionary(std::vector<T>&& sorted_values);
   void _create_dictionary(const std::shared_ptr<AbstractSegment>& abstract_segment);
   void _create_attribute_vector(const std::shared_ptr<AbstractSegment>& abstract_segment);
-  std::vector<T> _dictionary;
+  Dictionary _dictionary;
   std::shared_ptr<AbstractAttributeVector> _attribute_vector;
 };
 
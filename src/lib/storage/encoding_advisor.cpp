@@ -0,0 +1,276 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <unordered_map>
+
+#include "alp_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "fsst_segment.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Strings up to this length are stored inside std::string itself (small string optimization of libstdc++ and libc++).
+constexpr auto SSO_CAPACITY = size_t{15};
+
+constexpr EncodingType ENCODING_TYPES[] = {EncodingType::Dictionary, EncodingType::RunLength,
+                                           EncodingType::FrameOfReference, EncodingType::FSST, EncodingType::ALP};
+
+size_t null_bitmap_size(const SegmentProfile& profile) {
+  return profile.null_count > 0 ? (size_t{profile.row_count} + 7) / 8 : 0;
+}
+
+size_t attribute_vector_size(const SegmentProfile& profile) {
+  // The largest ValueID is the one representing NULL, which equals the dictionary size.
+  const auto bit_width =
+      BitPackedAttributeVector::required_bit_width(ValueID{static_cast<ValueID::base_type>(profile.distinct_count)});
+  const auto fixed_width = bit_width <= 8 ? size_t{1} : bit_width <= 16 ? size_t{2} : size_t{4};
+  return std::min(BitPackedAttributeVector::estimate_memory_usage(profile.row_count, bit_width),
+                  fixed_width * profile.row_count);
+}
+
+}  // namespace
+
+template <typename T>
+EncodingAdvisor<T>::EncodingAdvisor(const ValueSegment<T>& segment) {
+  const auto& values = segment.values();
+  const auto row_count = static_cast<ChunkOffset>(values.size());
+
+  // Take SAMPLE_WINDOW_COUNT windows of consecutive rows that are evenly spread over the segment, or the whole segment
+  // if it is small.
+  auto sample = std::vector<T>{};
+  auto sample_null_values = std::vector<bool>{};
+  const auto append_window = [&](const ChunkOffset begin, const ChunkOffset end) {
+    for (auto index = begin; index < end; ++index) {
+      sample.push_back(values[index]);
+      sample_null_values.push_back(segment.is_null(index));
+    }
+  };
+  if (row_count <= SAMPLE_WINDOW_COUNT * SAMPLE_WINDOW_SIZE) {
+    append_window(0, row_count);
+  } else {
+    const auto last_window_begin = size_t{row_count - SAMPLE_WINDOW_SIZE};
+    for (auto window = size_t{0}; window < SAMPLE_WINDOW_COUNT; ++window) {
+      const auto begin = static_cast<ChunkOffset>(window * last_window_begin / (SAMPLE_WINDOW_COUNT - 1));
+      append_window(begin, begin + SAMPLE_WINDOW_SIZE);
+    }
+  }
+
+  _create_profile(segment, sample, sample_null_values);
+  _create_estimates(sample, sample_null_values);
+}
+
+template <typename T>
+void EncodingAdvisor<T>::_create_profile(const ValueSegment<T>& segment, const std::vector<T>& sample,
+                                         const std::vector<bool>& sample_null_values) {
+  _profile.row_count = segment.size();
+  _profile.sample_size = static_cast<ChunkOffset>(sample.size());
+  if (sample.empty()) {
+    return;
+  }
+
+  const auto window_size = std::min(SAMPLE_WINDOW_SIZE, _profile.sample_size);
+  auto sample_null_count = size_t{0};
+  auto run_boundary_count = size_t{0};
+  auto comparison_count = size_t{0};
+  auto value_counts = std::unordered_map<T, size_t>{};
+  auto is_sorted = true;
+  auto previous_non_null = std::optional<T>{};
+  auto minimum = std::optional<T>{};
+  auto maximum = std::optional<T>{};
+  auto string_length_sum = size_t{0};
+
+  for (auto index = size_t{0}; index < sample.size(); ++index) {
+    const auto is_null = sample_null_values[index];
+
+    // Runs are only counted within windows, since consecutive windows are not adjacent in the segment.
+    if (index % window_size != 0) {
+      ++comparison_count;
+      if (is_null != sample_null_values[index - 1] || (!is_null && sample[index] != sample[index - 1])) {
+        ++run_boundary_count;
+      }
+    }
+
+    if (is_null) {
+      ++sample_null_count;
+      continue;
+    }
+
+    const auto& value = sample[index];
+    ++value_counts[value];
+    if (previous_non_null && value < *previous_non_null) {
+      is_sorted = false;
+    }
+    previous_non_null = value;
+    if (!minimum || value < *minimum) {
+      minimum = value;
+    }
+    if (!maximum || *maximum < value) {
+      maximum = value;
+    }
+    if constexpr (std::is_same_v<T, std::string>) {
+      string_length_sum += value.size();
+    }
+  }
+
+  const auto row_count = static_cast<double>(_profile.row_count);
+  // The NULL bitmap counts all NULLs of the segment, so the NULL count does not need to be extrapolated.
+  _profile.null_count = segment.is_nullable() ? segment.null_values().null_count() : 0;
+  _profile.run_count = 1;
+  if (comparison_count > 0) {
+    _profile.run_count += static_cast<size_t>(std::round(static_cast<double>(run_boundary_count) * (row_count - 1) /
+                                                         static_cast<double>(comparison_count)));
+  }
+  _profile.is_sorted = is_sorted;
+
+  // Estimate the number of distinct values with the Guaranteed-Error Estimator (Charikar et al.): values seen once in
+  // the sample stand for sqrt(rows / sample size) values each, values seen more often are likely all in the sample.
+  const auto non_null_sample_size = sample.size() - sample_null_count;
+  if (non_null_sample_size > 0) {
+    auto singleton_count = size_t{0};
+    for (const auto& [value, count] : value_counts) {
+      if (count == 1) {
+        ++singleton_count;
+      }
+    }
+    const auto non_null_row_count = _profile.row_count - std::min(size_t{_profile.row_count}, _profile.null_count);
+    const auto scale = std::sqrt(static_cast<double>(non_null_row_count) / static_cast<double>(non_null_sample_size));
+    const auto estimate = static_cast<size_t>(std::round(scale * static_cast<double>(singleton_count))) +
+                          (value_counts.size() - singleton_count);
+    _profile.distinct_count =
+        std::clamp(estimate, value_counts.size(), std::max(non_null_row_count, value_counts.size()));
+  }
+
+  if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>) {
+    if (minimum) {
+      using UnsignedT = std::make_unsigned_t<T>;
+      _profile.value_range_bit_width = static_cast<uint8_t>(
+          std::bit_width(static_cast<UnsignedT>(static_cast<UnsignedT>(*maximum) - static_cast<UnsignedT>(*minimum))));
+    }
+  }
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (non_null_sample_size > 0) {
+      _profile.average_string_length = string_length_sum / non_null_sample_size;
+    }
+  }
+}
+
+template <typename T>
+void EncodingAdvisor<T>::_create_estimates(const std::vector<T>& sample, const std::vector<bool>& sample_null_values) {
+  const auto& profile = _profile;
+  const auto row_count = size_t{profile.row_count};
+  const auto non_null_row_count = row_count - std::min(row_count, profile.null_count);
+
+  // Bytes per stored value, including the heap allocation of long strings.
+  auto value_size = sizeof(T);
+  if constexpr (std::is_same_v<T, std::string>) {
+    if (profile.average_string_length > SSO_CAPACITY) {
+      value_size += profile.average_string_length + 1;
+    }
+  }
+
+  // Encodings that depend on the actual bytes (FSST, ALP) are estimated by compressing the non-NULL values of the
+  // sample and extrapolating.
+  auto non_null_sample = std::make_shared<ValueSegment<T>>();
+  for (auto index = size_t{0}; index < sample.size(); ++index) {
+    if (!sample_null_values[index]) {
+      non_null_sample->append(sample[index]);
+    }
+  }
+  const auto non_null_sample_size = size_t{non_null_sample->size()};
+
+  for (const auto encoding_type : ENCODING_TYPES) {
+    if (!is_encoding_supported<T>(encoding_type)) {
+      continue;
+    }
+
+    auto memory_usage = size_t{0};
+    switch (encoding_type) {
+      case EncodingType::Dictionary: {
+        auto dictionary_size = profile.distinct_count * sizeof(T);
+        if constexpr (std::is_same_v<T, std::string>) {
+          // Length byte, characters, and restart offset of a StringDictionary without front coding.
+          dictionary_size = profile.distinct_count * (1 + profile.average_string_length + sizeof(uint32_t));
+        }
+        memory_usage = dictionary_size + attribute_vector_size(profile);
+      } break;
+
+      case EncodingType::RunLength:
+        memory_usage = profile.run_count * (value_size + sizeof(ChunkOffset)) + (profile.run_count + 7) / 8;
+        break;
+
+      case EncodingType::FrameOfReference: {
+        constexpr auto block_size = size_t{FrameOfReferenceSegment<int32_t>::BLOCK_SIZE};
+        // For sorted data, each block only spans its share of the value range.
+        auto bit_width = size_t{profile.value_range_bit_width};
+        if (profile.is_sorted && row_count > block_size) {
+          bit_width -= std::min(bit_width, size_t{std::bit_width(row_count / block_size) - 1});
+        }
+        const auto block_count = (row_count + block_size - 1) / block_size;
+        memory_usage = (row_count * bit_width + 7) / 8 + block_count * (sizeof(T) + sizeof(uint8_t) + sizeof(size_t)) +
+                       null_bitmap_size(profile);
+      } break;
+
+      case EncodingType::FSST:
+        if constexpr (std::is_same_v<T, std::string>) {
+          auto compressed_size = size_t{0};
+          auto raw_size = size_t{0};
+          auto symbol_table_size = size_t{0};
+          if (non_null_sample_size > 0) {
+            const auto fsst_segment = FSSTSegment<std::string>{non_null_sample};
+            for (auto index = ChunkOffset{0}; index < non_null_sample_size; ++index) {
+              compressed_size += fsst_segment.compressed_value(index).size();
+              raw_size += non_null_sample->values()[index].size();
+            }
+            symbol_table_size = fsst_segment.symbol_count() * (sizeof(uint64_t) + sizeof(uint8_t)) +
+                                257 * sizeof(uint16_t);
+          }
+          const auto compression_ratio =
+              raw_size == 0 ? 1.0 : static_cast<double>(compressed_size) / static_cast<double>(raw_size);
+          memory_usage = static_cast<size_t>(static_cast<double>(non_null_row_count * profile.average_string_length) *
+                                             compression_ratio) +
+                         (row_count + 1) * sizeof(uint32_t) + symbol_table_size + null_bitmap_size(profile);
+        }
+        break;
+
+      case EncodingType::ALP:
+        if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+          if (non_null_sample_size > 0) {
+            const auto alp_segment = ALPSegment<T>{non_null_sample};
+            memory_usage = alp_segment.estimate_memory_usage() * non_null_row_count / non_null_sample_size;
+          }
+          memory_usage += null_bitmap_size(profile);
+        }
+        break;
+    }
+    _estimates.push_back({encoding_type, memory_usage});
+  }
+
+  // Keep the order of ENCODING_TYPES for equal estimates, so that dictionary encoding wins ties.
+  std::stable_sort(_estimates.begin(), _estimates.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.memory_usage < rhs.memory_usage; });
+}
+
+template <typename T>
+const SegmentProfile& EncodingAdvisor<T>::profile() const {
+  return _profile;
+}
+
+template <typename T>
+const std::vector<EncodingEstimate>& EncodingAdvisor<T>::estimates() const {
+  return _estimates;
+}
+
+template <typename T>
+EncodingType EncodingAdvisor<T>::recommended_encoding() const {
+  return _estimates.front().encoding_type;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EncodingAdvisor);
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegment;
+
+// Returns whether the given encoding is defined for the data type T.
+template <typename T>
+constexpr bool is_encoding_supported(const EncodingType encoding_type) {
+  switch (encoding_type) {
+    case EncodingType::Dictionary:
+    case EncodingType::RunLength:
+      return true;
+    case EncodingType::FrameOfReference:
+      return std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>;
+    case EncodingType::FSST:
+      return std::is_same_v<T, std::string>;
+    case EncodingType::ALP:
+      return std::is_same_v<T, float> || std::is_same_v<T, double>;
+  }
+  return false;
+}
+
+// Properties of a ValueSegment the memory usage of the encodings is estimated from. They are computed on a sample of
+// evenly spread windows of consecutive rows, so that runs are preserved. Counts refer to the full segment and are
+// extrapolated from the sample, except for null_count, which is taken from the NULL bitmap.
+struct SegmentProfile {
+  ChunkOffset row_count{0};
+  ChunkOffset sample_size{0};
+  size_t null_count{0};
+  size_t distinct_count{0};
+  size_t run_count{0};
+  // Whether the sampled values are in non-decreasing order.
+  bool is_sorted{false};
+  // Number of bits needed for the difference between the largest and smallest value (integers only).
+  uint8_t value_range_bit_width{0};
+  // Average number of characters per value (strings only).
+  size_t average_string_length{0};
+};
+
+// Estimated memory usage of a segment encoded with the given encoding.
+struct EncodingEstimate {
+  EncodingType encoding_type;
+  size_t memory_usage;
+};
+
+// Outcome of encoding a single segment, as reported by Table::compress_chunk.
+struct EncodingDecision {
+  EncodingType encoding_type;
+  // Whether the encoding was forced by the caller or a column override instead of chosen by the EncodingAdvisor.
+  bool is_forced;
+  // Memory usage of the ValueSegment before and of the encoded segment after compression.
+  size_t uncompressed_memory_usage;
+  size_t memory_usage;
+};
+
+// The EncodingAdvisor samples a ValueSegment and estimates the memory usage of every encoding defined for its data
+// type. Table::compress_chunk uses it to pick the cheapest encoding per segment unless an encoding is forced.
+template <typename T>
+class EncodingAdvisor {
+ public:
+  explicit EncodingAdvisor(const ValueSegment<T>& segment);
+
+  // Returns the sampled properties of the segment.
+  const SegmentProfile& profile() const;
+
+  // Returns the estimated memory usage of every encoding defined for T, cheapest first.
+  const std::vector<EncodingEstimate>& estimates() const;
+
+  // Returns the encoding with the lowest estimated memory usage.
+  EncodingType recommended_encoding() const;
+
+  // Number of windows and rows per window of the sample.
+  static constexpr auto SAMPLE_WINDOW_COUNT = ChunkOffset{16};
+  static constexpr auto SAMPLE_WINDOW_SIZE = ChunkOffset{64};
+
+ protected:
+  void _create_profile(const ValueSegment<T>& segment, const std::vector<T>& sample,
+                       const std::vector<bool>& sample_null_values);
+  void _create_estimates(const std::vector<T>& sample, const std::vector<bool>& sample_null_values);
+
+  SegmentProfile _profile;
+  std::vector<EncodingEstimate> _estimates;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(EncodingAdvisor);
+
+}  // namespace opossum
@@ -0,0 +1,160 @@
+#include "equi_depth_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the estimated share of the bin's values that are smaller than a value with min < value <= max. Strings
+// cannot be interpolated, so half of the bin is assumed.
+template <typename T>
+double fraction_below(const HistogramBin<T>& bin, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return 0.5;
+  } else if constexpr (std::is_integral_v<T>) {
+    // The bin holds max - min + 1 possible values, min is the only one of them below min + 1.
+    return (static_cast<double>(value) - static_cast<double>(bin.min)) /
+           (static_cast<double>(bin.max) - static_cast<double>(bin.min) + 1.0);
+  } else {
+    return (static_cast<double>(value) - static_cast<double>(bin.min)) /
+           (static_cast<double>(bin.max) - static_cast<double>(bin.min));
+  }
+}
+
+}  // namespace
+
+template <typename T>
+EquiDepthHistogram<T>::EquiDepthHistogram(std::vector<HistogramBin<T>> bins) : _bins{std::move(bins)} {}
+
+template <typename T>
+EquiDepthHistogram<T> EquiDepthHistogram<T>::from_sorted_values(const std::vector<T>& sorted_values,
+                                                                const size_t max_bin_count) {
+  Assert(max_bin_count > 0, "A histogram needs at least one bin.");
+  const auto value_count = sorted_values.size();
+  const auto target_depth = static_cast<double>((value_count + max_bin_count - 1) / max_bin_count);
+
+  auto bins = std::vector<HistogramBin<T>>{};
+  bins.reserve(std::min(value_count, max_bin_count));
+  auto run_begin = sorted_values.begin();
+  while (run_begin != sorted_values.end()) {
+    const auto run_end = std::upper_bound(run_begin, sorted_values.end(), *run_begin);
+    const auto run_length = static_cast<double>(std::distance(run_begin, run_end));
+    // Each closed bin holds at least target_depth values, so there are at most max_bin_count bins.
+    if (bins.empty() || bins.back().height >= target_depth) {
+      bins.push_back({*run_begin, *run_begin, run_length, 1.0});
+    } else {
+      auto& bin = bins.back();
+      bin.max = *run_begin;
+      bin.height += run_length;
+      ++bin.distinct_count;
+    }
+    run_begin = run_end;
+  }
+  return EquiDepthHistogram{std::move(bins)};
+}
+
+template <typename T>
+EquiDepthHistogram<T> EquiDepthHistogram<T>::merge(const EquiDepthHistogram& lhs, const EquiDepthHistogram& rhs,
+                                                   const size_t max_bin_count) {
+  Assert(max_bin_count > 0, "A histogram needs at least one bin.");
+  auto input_bins = std::vector<HistogramBin<T>>{};
+  input_bins.reserve(lhs._bins.size() + rhs._bins.size());
+  input_bins.insert(input_bins.end(), lhs._bins.begin(), lhs._bins.end());
+  input_bins.insert(input_bins.end(), rhs._bins.begin(), rhs._bins.end());
+  std::stable_sort(input_bins.begin(), input_bins.end(),
+                   [](const auto& left, const auto& right) { return left.min < right.min; });
+
+  const auto target_depth = (lhs.total_count() + rhs.total_count()) / static_cast<double>(max_bin_count);
+  auto bins = std::vector<HistogramBin<T>>{};
+  bins.reserve(std::min(input_bins.size(), max_bin_count));
+  for (const auto& input_bin : input_bins) {
+    if (bins.empty() || (bins.back().height >= target_depth && bins.size() < max_bin_count)) {
+      bins.push_back(input_bin);
+      continue;
+    }
+    auto& bin = bins.back();
+    bin.max = std::max(bin.max, input_bin.max);
+    bin.height += input_bin.height;
+    bin.distinct_count += input_bin.distinct_count;
+  }
+  return EquiDepthHistogram{std::move(bins)};
+}
+
+template <typename T>
+void EquiDepthHistogram<T>::scale_distinct_counts(const double distinct_count) {
+  auto total_distinct_count = 0.0;
+  for (const auto& bin : _bins) {
+    total_distinct_count += bin.distinct_count;
+  }
+  if (total_distinct_count == 0.0) {
+    return;
+  }
+
+  const auto factor = distinct_count / total_distinct_count;
+  for (auto& bin : _bins) {
+    bin.distinct_count = std::clamp(bin.distinct_count * factor, 1.0, std::max(bin.height, 1.0));
+  }
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::estimate_count(const ScanType scan_type, const T& search_value) const {
+  const auto total = total_count();
+  if constexpr (std::is_floating_point_v<T>) {
+    // Comparisons with NaN are false, only "!=" holds for all values.
+    if (std::isnan(search_value)) {
+      return scan_type == ScanType::OpNotEquals ? total : 0.0;
+    }
+  }
+
+  auto equal_count = 0.0;
+  auto less_count = 0.0;
+  for (const auto& bin : _bins) {
+    const auto bin_equal_count =
+        (search_value < bin.min || bin.max < search_value) ? 0.0 : bin.height / bin.distinct_count;
+    equal_count += bin_equal_count;
+    if (bin.max < search_value) {
+      less_count += bin.height;
+    } else if (bin.min < search_value) {
+      less_count += std::min(bin.height * fraction_below(bin, search_value), bin.height - bin_equal_count);
+    }
+  }
+
+  // Clamp to avoid negative counts from rounding errors.
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return equal_count;
+    case ScanType::OpNotEquals:
+      return std::max(total - equal_count, 0.0);
+    case ScanType::OpLessThan:
+      return less_count;
+    case ScanType::OpLessThanEquals:
+      return less_count + equal_count;
+    case ScanType::OpGreaterThan:
+      return std::max(total - less_count - equal_count, 0.0);
+    case ScanType::OpGreaterThanEquals:
+      return std::max(total - less_count, 0.0);
+  }
+  Fail("Unknown scan type.");
+}
+
+template <typename T>
+double EquiDepthHistogram<T>::total_count() const {
+  auto total = 0.0;
+  for (const auto& bin : _bins) {
+    total += bin.height;
+  }
+  return total;
+}
+
+template <typename T>
+const std::vector<HistogramBin<T>>& EquiDepthHistogram<T>::bins() const {
+  return _bins;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
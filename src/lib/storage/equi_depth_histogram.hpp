@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// A bin of a histogram: the number of values in [min, max] and how many of them are distinct.
+template <typename T>
+struct HistogramBin {
+  T min;
+  T max;
+  double height;
+  double distinct_count;
+};
+
+// EquiDepthHistogram summarizes the distribution of values by bins of (roughly) the same number of values. Within a
+// bin, values are assumed to be distributed uniformly and to occur equally often. Equi-depth bins keep this error
+// small where most values are, unlike equi-width bins, which are skewed by outliers.
+// Histograms are built per chunk and merged into a histogram of the whole column. Merged bins may overlap, since the
+// bins of different chunks do; estimations therefore sum up the contribution of every bin.
+template <typename T>
+class EquiDepthHistogram {
+ public:
+  // Creates a histogram from bins sorted by their minimum.
+  explicit EquiDepthHistogram(std::vector<HistogramBin<T>> bins = {});
+
+  // Builds a histogram with at most max_bin_count bins from sorted values. All occurrences of a value are put into the
+  // same bin, so the distinct counts of the bins are exact.
+  static EquiDepthHistogram from_sorted_values(const std::vector<T>& sorted_values, const size_t max_bin_count);
+
+  // Combines two histograms into one with at most max_bin_count bins by concatenating neighboring bins. The distinct
+  // counts of the result are upper bounds, since values may occur in both histograms; see scale_distinct_counts.
+  static EquiDepthHistogram merge(const EquiDepthHistogram& lhs, const EquiDepthHistogram& rhs,
+                                  const size_t max_bin_count);
+
+  // Scales the distinct counts of the bins so that they add up to the given total, e.g., a HyperLogLog estimate.
+  // Each bin keeps at least one and at most height distinct values.
+  void scale_distinct_counts(const double distinct_count);
+
+  // Returns the estimated number of values v for which "v <scan_type> search_value" holds.
+  double estimate_count(const ScanType scan_type, const T& search_value) const;
+
+  // Returns the number of values in all bins.
+  double total_count() const;
+
+  const std::vector<HistogramBin<T>>& bins() const;
+
+ protected:
+  std::vector<HistogramBin<T>> _bins;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
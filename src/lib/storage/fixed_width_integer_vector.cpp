@@ -1,10 +1,71 @@
 #include "fixed_width_integer_vector.hpp"
 #include <memory>
 #include <bit>
+#include <cstring>
+#include <type_traits>
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+#include "bit_packed_attribute_vector.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+static_assert(sizeof(ValueID) == sizeof(uint32_t) && std::is_trivially_copyable_v<ValueID>,
+              "Decoding kernels write ValueIDs as raw uint32_t values.");
+
+// Widening kernels that convert count narrow value ids into 32-bit ValueIDs. Which kernel is used is decided at compile
+// time. Release builds use -march=native and thus get the AVX2 or SSE4.1 version on current x86 CPUs, all other
+// builds fall back to the scalar loop, which compilers auto-vectorize reasonably well.
+template <typename T>
+void widen_scalar(const T* input, const size_t count, ValueID* output) {
+  for (auto index = size_t{0}; index < count; ++index) {
+    output[index] = ValueID{input[index]};
+  }
+}
+
+void widen(const uint8_t* input, const size_t count, ValueID* output) {
+  auto index = size_t{0};
+#if defined(__AVX2__)
+  for (; index + 8 <= count; index += 8) {
+    const auto narrow = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + index));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), _mm256_cvtepu8_epi32(narrow));
+  }
+#elif defined(__SSE4_1__)
+  for (; index + 4 <= count; index += 4) {
+    auto narrow_bits = int32_t{};
+    std::memcpy(&narrow_bits, input + index, sizeof(narrow_bits));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_cvtepu8_epi32(_mm_cvtsi32_si128(narrow_bits)));
+  }
+#endif
+  widen_scalar(input + index, count - index, output + index);
+}
+
+void widen(const uint16_t* input, const size_t count, ValueID* output) {
+  auto index = size_t{0};
+#if defined(__AVX2__)
+  for (; index + 8 <= count; index += 8) {
+    const auto narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), _mm256_cvtepu16_epi32(narrow));
+  }
+#elif defined(__SSE4_1__)
+  for (; index + 4 <= count; index += 4) {
+    const auto narrow = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + index));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_cvtepu16_epi32(narrow));
+  }
+#endif
+  widen_scalar(input + index, count - index, output + index);
+}
+
+void widen(const uint32_t* input, const size_t count, ValueID* output) {
+  // No widening necessary, the value ids already have their final layout.
+  std::memcpy(static_cast<void*>(output), input, count * sizeof(uint32_t));
+}
+
+}  // namespace
+
 template <typename T>
 FixedWidthIntegerVector<T>::FixedWidthIntegerVector(size_t size) : _value_ids(size) {}
 
@@ -36,6 +97,18 @@ AttributeVectorWidth FixedWidthIntegerVector<T>::width() const {
   return sizeof(T);
 }
 
+template <typename T>
+size_t FixedWidthIntegerVector<T>::estimate_memory_usage() const {
+  return sizeof(T) * size();
+}
+
+template <typename T>
+void FixedWidthIntegerVector<T>::decode(const size_t begin, const size_t count, ValueID* output) const {
+  Assert(begin + count <= size(), "Range [" + std::to_string(begin) + ", " + std::to_string(begin + count) +
+                                      ") is out of range.");
+  widen(_value_ids.data() + begin, count, output);
+}
+
 template <typename T>
 ValueID FixedWidthIntegerVector<T>::get(const size_t index) const {
   Assert(index < size(), "Index " + std::to_string(index) + " is out of range.");
@@ -50,19 +123,32 @@ std::shared_ptr<AbstractAttributeVector> compress_attribute_vector(const std::ve
   const auto max_element = *std::max_element(value_ids.begin(), value_ids.end());
   Assert(max_element < INVALID_VALUE_ID, "Maximum ValueID is too large.");
 
-  auto compressed_value_ids = std::shared_ptr<AbstractAttributeVector>();
-
+  auto fixed_width = size_t{0};
   if (max_element <= std::numeric_limits<uint8_t>::max()) {
-    compressed_value_ids = std::make_shared<FixedWidthIntegerVector<uint8_t>>(value_ids);
+    fixed_width = sizeof(uint8_t);
   } else if (max_element <= std::numeric_limits<uint16_t>::max()) {
-    compressed_value_ids = std::make_shared<FixedWidthIntegerVector<uint16_t>>(value_ids);
+    fixed_width = sizeof(uint16_t);
   } else if (max_element <= std::numeric_limits<uint32_t>::max()) {
-    compressed_value_ids = std::make_shared<FixedWidthIntegerVector<uint32_t>>(value_ids);
+    fixed_width = sizeof(uint32_t);
   } else {
     Fail("Too many unique values in dictionary segment (" + std::to_string(max_element) +
          " unique values).");
   }
-  return compressed_value_ids;
+
+  // Bit-packing only pays off if the saved bits per value outweigh the padding of the last 64-bit word.
+  const auto bit_width = BitPackedAttributeVector::required_bit_width(max_element);
+  if (BitPackedAttributeVector::estimate_memory_usage(value_ids.size(), bit_width) < fixed_width * value_ids.size()) {
+    return std::make_shared<BitPackedAttributeVector>(value_ids, bit_width);
+  }
+
+  switch (fixed_width) {
+    case sizeof(uint8_t):
+      return std::make_shared<FixedWidthIntegerVector<uint8_t>>(value_ids);
+    case sizeof(uint16_t):
+      return std::make_shared<FixedWidthIntegerVector<uint16_t>>(value_ids);
+    default:
+      return std::make_shared<FixedWidthIntegerVector<uint32_t>>(value_ids);
+  }
 }
 
 template class FixedWidthIntegerVector<uint32_t>;
@@ -25,12 +25,21 @@ class FixedWidthIntegerVector : public AbstractAttributeVector {
   // Returns the width of biggest value id in bytes.
   AttributeVectorWidth width() const override;
 
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const override;
+
+  // Decodes the value ids in [begin, begin + count) into output, widening them with SIMD instructions if available.
+  void decode(const size_t begin, const size_t count, ValueID* output) const override;
+
  private:
   // Stores ValueIDs for all original elements.
   std::vector<T> _value_ids;
 };
 
+// Creates the smallest attribute vector for the given value ids. This is a FixedWidthIntegerVector with the smallest
+// sufficient width or a BitPackedAttributeVector if packing the value ids at their minimal bit width saves memory.
 std::shared_ptr<AbstractAttributeVector> compress_attribute_vector(const std::vector<ValueID>& value_ids);
+
 // Explicitly instantiate types
 extern template class FixedWidthIntegerVector<uint32_t>;
 extern template class FixedWidthIntegerVector<uint16_t>;
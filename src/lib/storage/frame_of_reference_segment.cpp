@@ -0,0 +1,169 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "bit_packing.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  _compress(abstract_segment);
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::_compress(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  _size = abstract_segment->size();
+
+  // Materialize the values once. NULL values are replaced by the block minimum below so that they do not widen the
+  // offsets.
+  auto values = std::vector<T>(_size);
+  auto null_values = std::vector<bool>(_size);
+  auto has_null_values = false;
+  for (auto index = ChunkOffset{0}; index < _size; ++index) {
+    const auto variant = abstract_segment->operator[](index);
+    if (variant_is_null(variant)) {
+      null_values[index] = true;
+      has_null_values = true;
+      continue;
+    }
+    values[index] = type_cast<T>(variant);
+  }
+  if (has_null_values) {
+    _null_values = std::move(null_values);
+  }
+
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_minimums.reserve(block_count);
+  _block_bit_widths.reserve(block_count);
+  _block_word_offsets.reserve(block_count);
+
+  for (auto block_begin = ChunkOffset{0}; block_begin < _size; block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(_size, block_begin + BLOCK_SIZE);
+
+    auto minimum = std::numeric_limits<T>::max();
+    auto maximum = std::numeric_limits<T>::min();
+    for (auto index = block_begin; index < block_end; ++index) {
+      if (has_null_values && _null_values[index]) {
+        continue;
+      }
+      minimum = std::min(minimum, values[index]);
+      maximum = std::max(maximum, values[index]);
+    }
+
+    // A block consisting of NULL values only.
+    if (minimum > maximum) {
+      minimum = T{0};
+      maximum = T{0};
+    }
+
+    // The unsigned difference is well-defined even if max - min overflows T.
+    const auto bit_width =
+        static_cast<uint8_t>(std::bit_width(static_cast<UnsignedT>(static_cast<UnsignedT>(maximum) - minimum)));
+    const auto word_offset = _packed_offsets.size();
+    _packed_offsets.resize(word_offset + packed_word_count(block_end - block_begin, bit_width));
+
+    auto bit_position = size_t{0};
+    for (auto index = block_begin; index < block_end; ++index) {
+      if (!has_null_values || !_null_values[index]) {
+        const auto offset = static_cast<UnsignedT>(static_cast<UnsignedT>(values[index]) - minimum);
+        pack_bits(_packed_offsets.data() + word_offset, bit_position, offset, bit_width);
+      }
+      bit_position += bit_width;
+    }
+
+    _block_minimums.push_back(minimum);
+    _block_bit_widths.push_back(bit_width);
+    _block_word_offsets.push_back(word_offset);
+  }
+}
+
+template <typename T>
+AllTypeVariant FrameOfReferenceSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto optional = get_typed_value(chunk_offset);
+  if (optional) {
+    return optional.value();
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T FrameOfReferenceSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional = get_typed_value(chunk_offset);
+  Assert(optional, "Value at offset " + std::to_string(chunk_offset) + " is NULL.");
+  return optional.value();
+}
+
+template <typename T>
+std::optional<T> FrameOfReferenceSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+  const auto block_index = chunk_offset / BLOCK_SIZE;
+  const auto bit_width = _block_bit_widths[block_index];
+  const auto offset = unpack_bits(_packed_offsets.data() + _block_word_offsets[block_index],
+                                  size_t{chunk_offset % BLOCK_SIZE} * bit_width, bit_width);
+  return static_cast<T>(static_cast<UnsignedT>(_block_minimums[block_index]) + static_cast<UnsignedT>(offset));
+}
+
+template <typename T>
+bool FrameOfReferenceSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < _size, "Value at offset " + std::to_string(chunk_offset) + " does not exist.");
+  return !_null_values.empty() && _null_values[chunk_offset];
+}
+
+template <typename T>
+const std::vector<bool>& FrameOfReferenceSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+const std::vector<T>& FrameOfReferenceSegment<T>::block_minimums() const {
+  return _block_minimums;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::block_count() const {
+  return _block_minimums.size();
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::decode_block(const size_t block_index, T* output) const {
+  Assert(block_index < block_count(), "Block " + std::to_string(block_index) + " does not exist.");
+  const auto block_size = std::min(BLOCK_SIZE, static_cast<ChunkOffset>(_size - block_index * BLOCK_SIZE));
+  const auto minimum = static_cast<UnsignedT>(_block_minimums[block_index]);
+  unpack_bits(_packed_offsets.data() + _block_word_offsets[block_index], 0, block_size,
+              _block_bit_widths[block_index], [output, minimum](const size_t index, const uint64_t offset) {
+                output[index] = static_cast<T>(minimum + static_cast<UnsignedT>(offset));
+              });
+}
+
+template <typename T>
+ChunkOffset FrameOfReferenceSegment<T>::size() const {
+  return _size;
+}
+
+template <typename T>
+DataType FrameOfReferenceSegment<T>::data_type() const {
+  return data_type_of<T>;
+}
+
+template <typename T>
+SegmentType FrameOfReferenceSegment<T>::segment_type() const {
+  return SegmentType::FrameOfReference;
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return sizeof(T) * _block_minimums.capacity() + sizeof(uint8_t) * _block_bit_widths.capacity() +
+         sizeof(size_t) * _block_word_offsets.capacity() + sizeof(uint64_t) * _packed_offsets.capacity() +
+         (_null_values.capacity() + 7) / 8;
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is a specific segment type for integer columns. It splits the values into blocks of
+// BLOCK_SIZE rows and stores the minimum of each block plus, for each row, the offset of its value to the block
+// minimum. The offsets of a block are bit-packed at the minimal width needed for the largest offset of that block.
+// This works well for columns with many distinct but close values (e.g., surrogate keys), where a dictionary would
+// be nearly as large as the data itself. FrameOfReferenceSegment is only defined for int32_t and int64_t.
+template <typename T>
+class FrameOfReferenceSegment : public AbstractSegment {
+ public:
+  static_assert(std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>,
+                "FrameOfReferenceSegment is only defined for int32_t and int64_t.");
+
+  /**
+   * Creates a FrameOfReference segment from a given value segment.
+   */
+  explicit FrameOfReferenceSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns NULL value vector that indicates whether a value is NULL with true at position i. It is empty if the
+  // segment does not contain any NULL values.
+  const std::vector<bool>& null_values() const;
+
+  // Returns the minimum of each block.
+  const std::vector<T>& block_minimums() const;
+
+  // Returns the number of blocks.
+  size_t block_count() const;
+
+  // Decodes all values of the given block into output, which has to hold BLOCK_SIZE values (the last block may hold
+  // fewer values). NULL values decode to the block minimum.
+  void decode_block(const size_t block_index, T* output) const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  DataType data_type() const final;
+
+  SegmentType segment_type() const final;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+  // Number of rows sharing a minimum and an offset bit width.
+  static constexpr auto BLOCK_SIZE = ChunkOffset{2048};
+
+ protected:
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  void _compress(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  std::vector<T> _block_minimums;
+  std::vector<uint8_t> _block_bit_widths;
+  // Index of the first word of each block in _packed_offsets. Blocks always start at a word boundary.
+  std::vector<size_t> _block_word_offsets;
+  std::vector<uint64_t> _packed_offsets;
+  std::vector<bool> _null_values;
+  ChunkOffset _size{0};
+};
+
+extern template class FrameOfReferenceSegment<int32_t>;
+extern template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
@@ -0,0 +1,283 @@
+#include "fsst_segment.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#include "bit_packing.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Number of refinement rounds of the symbol table. The FSST paper finds five rounds to be sufficient.
+constexpr auto TRAINING_GENERATION_COUNT = 5;
+
+// Upper bound for the number of bytes the symbol table is learned from.
+constexpr auto TRAINING_SAMPLE_BYTES = size_t{16'384};
+
+// Codes 0 to 254 refer to symbols, 255 is the escape code.
+constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+
+// Symbols are compared as words, which requires the first byte of a string to be the least significant one.
+static_assert(std::endian::native == std::endian::little, "FSSTSegment requires a little-endian platform.");
+
+uint64_t load_word(const char* data, const size_t length) {
+  auto word = uint64_t{0};
+  std::memcpy(&word, data, std::min(length, sizeof(uint64_t)));
+  return word;
+}
+
+}  // namespace
+
+template <typename T>
+FSSTSegment<T>::FSSTSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  _compress(abstract_segment);
+}
+
+template <typename T>
+void FSSTSegment<T>::_compress(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  const auto segment_size = abstract_segment->size();
+
+  auto values = std::vector<std::string>(segment_size);
+  auto null_values = std::vector<bool>(segment_size);
+  auto has_null_values = false;
+  for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
+    const auto variant = abstract_segment->operator[](index);
+    if (variant_is_null(variant)) {
+      null_values[index] = true;
+      has_null_values = true;
+      continue;
+    }
+    values[index] = type_cast<T>(variant);
+  }
+
+  _build_symbol_table(values, null_values);
+
+  _offsets.reserve(segment_size + 1);
+  _offsets.push_back(0);
+  for (const auto& value : values) {
+    // NULL values are empty strings here and thus occupy no compressed bytes.
+    _append_compressed(value, _compressed_values);
+    Assert(_compressed_values.size() <= std::numeric_limits<uint32_t>::max(), "FSST segment exceeds 4 GB.");
+    _offsets.push_back(static_cast<uint32_t>(_compressed_values.size()));
+  }
+  _compressed_values.shrink_to_fit();
+
+  if (has_null_values) {
+    _null_values = std::move(null_values);
+  }
+}
+
+template <typename T>
+void FSSTSegment<T>::_build_symbol_table(const std::vector<std::string>& values,
+                                         const std::vector<bool>& null_values) {
+  // Take every n-th value so that the sample covers the whole segment but stays within TRAINING_SAMPLE_BYTES.
+  auto total_bytes = size_t{0};
+  for (const auto& value : values) {
+    total_bytes += value.size();
+  }
+  const auto stride = std::max(size_t{1}, (total_bytes + TRAINING_SAMPLE_BYTES - 1) / TRAINING_SAMPLE_BYTES);
+  auto sample = std::vector<std::string_view>{};
+  for (auto index = size_t{0}; index < values.size(); index += stride) {
+    if (!null_values[index] && !values[index].empty()) {
+      sample.emplace_back(values[index]);
+    }
+  }
+
+  // Each generation compresses the sample with the current symbol table and counts how often each symbol and each
+  // pair of adjacent symbols occurs. The symbols and concatenated pairs that save the most bytes form the next
+  // table. Bytes without a symbol count as single-byte candidates, so the table can grow from the empty table.
+  for (auto generation = 0; generation < TRAINING_GENERATION_COUNT; ++generation) {
+    auto candidate_counts = std::unordered_map<std::string_view, size_t>{};
+    auto concatenation_counts = std::unordered_map<std::string, size_t>{};
+
+    for (const auto value : sample) {
+      auto previous = std::string_view{};
+      for (auto position = size_t{0}; position < value.size();) {
+        const auto code = _find_symbol(value.data() + position, value.size() - position);
+        const auto length = code == ESCAPE_CODE ? size_t{1} : size_t{_symbol_lengths[code]};
+        const auto symbol = value.substr(position, length);
+        ++candidate_counts[symbol];
+        if (!previous.empty() && previous.size() + symbol.size() <= MAX_SYMBOL_LENGTH) {
+          ++concatenation_counts[std::string{previous}.append(symbol)];
+        }
+        previous = symbol;
+        position += length;
+      }
+    }
+
+    // The gain of a symbol is the number of bytes it covers in the sample.
+    auto candidates = std::vector<std::pair<size_t, std::string>>{};
+    candidates.reserve(candidate_counts.size() + concatenation_counts.size());
+    for (const auto& [symbol, count] : candidate_counts) {
+      candidates.emplace_back(count * symbol.size(), std::string{symbol});
+    }
+    for (const auto& [symbol, count] : concatenation_counts) {
+      if (!candidate_counts.contains(symbol)) {
+        candidates.emplace_back(count * symbol.size(), symbol);
+      }
+    }
+
+    // Sort by descending gain. Ties are broken by the symbol itself to keep the result deterministic.
+    const auto candidate_count = std::min(MAX_SYMBOL_COUNT, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(candidate_count),
+                      candidates.end(), [](const auto& lhs, const auto& rhs) {
+                        return lhs.first != rhs.first ? lhs.first > rhs.first : lhs.second < rhs.second;
+                      });
+
+    auto symbols = std::vector<std::string>{};
+    symbols.reserve(candidate_count);
+    for (auto index = size_t{0}; index < candidate_count; ++index) {
+      symbols.push_back(std::move(candidates[index].second));
+    }
+    _set_symbols(std::move(symbols));
+  }
+}
+
+template <typename T>
+void FSSTSegment<T>::_set_symbols(std::vector<std::string> symbols) {
+  DebugAssert(symbols.size() <= MAX_SYMBOL_COUNT, "Too many symbols.");
+  std::sort(symbols.begin(), symbols.end(), [](const auto& lhs, const auto& rhs) {
+    if (lhs[0] != rhs[0]) {
+      return static_cast<uint8_t>(lhs[0]) < static_cast<uint8_t>(rhs[0]);
+    }
+    return lhs.size() != rhs.size() ? lhs.size() > rhs.size() : lhs < rhs;
+  });
+
+  _symbols.clear();
+  _symbol_lengths.clear();
+  _first_byte_codes.fill(0);
+  for (const auto& symbol : symbols) {
+    DebugAssert(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH, "Invalid symbol length.");
+    _symbols.push_back(load_word(symbol.data(), symbol.size()));
+    _symbol_lengths.push_back(static_cast<uint8_t>(symbol.size()));
+    ++_first_byte_codes[static_cast<uint8_t>(symbol[0]) + 1];
+  }
+
+  // Turn the counts per first byte into the first code per first byte.
+  for (auto byte = size_t{1}; byte < _first_byte_codes.size(); ++byte) {
+    _first_byte_codes[byte] += _first_byte_codes[byte - 1];
+  }
+}
+
+template <typename T>
+uint8_t FSSTSegment<T>::_find_symbol(const char* data, const size_t length) const {
+  const auto first_byte = static_cast<uint8_t>(data[0]);
+  const auto word = load_word(data, length);
+  for (auto code = _first_byte_codes[first_byte]; code < _first_byte_codes[first_byte + 1]; ++code) {
+    const auto symbol_length = _symbol_lengths[code];
+    if (symbol_length <= length && (word & bit_mask(static_cast<uint8_t>(symbol_length * 8))) == _symbols[code]) {
+      return static_cast<uint8_t>(code);
+    }
+  }
+  return ESCAPE_CODE;
+}
+
+template <typename T>
+template <typename Output>
+void FSSTSegment<T>::_append_compressed(const std::string_view value, Output& output) const {
+  for (auto position = size_t{0}; position < value.size();) {
+    const auto code = _find_symbol(value.data() + position, value.size() - position);
+    output.push_back(static_cast<char>(code));
+    if (code == ESCAPE_CODE) {
+      output.push_back(value[position]);
+      ++position;
+    } else {
+      position += _symbol_lengths[code];
+    }
+  }
+}
+
+template <typename T>
+AllTypeVariant FSSTSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto optional = get_typed_value(chunk_offset);
+  if (optional) {
+    return optional.value();
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T FSSTSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional = get_typed_value(chunk_offset);
+  Assert(optional, "Value at offset " + std::to_string(chunk_offset) + " is NULL.");
+  return optional.value();
+}
+
+template <typename T>
+std::optional<T> FSSTSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (is_null(chunk_offset)) {
+    return std::nullopt;
+  }
+
+  const auto compressed = compressed_value(chunk_offset);
+  auto value = std::string{};
+  value.reserve(compressed.size() * 2);
+  for (auto position = size_t{0}; position < compressed.size(); ++position) {
+    const auto code = static_cast<uint8_t>(compressed[position]);
+    if (code == ESCAPE_CODE) {
+      value.push_back(compressed[++position]);
+      continue;
+    }
+    auto symbol = std::array<char, MAX_SYMBOL_LENGTH>{};
+    std::memcpy(symbol.data(), &_symbols[code], MAX_SYMBOL_LENGTH);
+    value.append(symbol.data(), _symbol_lengths[code]);
+  }
+  return value;
+}
+
+template <typename T>
+bool FSSTSegment<T>::is_null(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Value at offset " + std::to_string(chunk_offset) + " does not exist.");
+  return !_null_values.empty() && _null_values[chunk_offset];
+}
+
+template <typename T>
+std::string_view FSSTSegment<T>::compressed_value(const ChunkOffset chunk_offset) const {
+  DebugAssert(chunk_offset < size(), "Value at offset " + std::to_string(chunk_offset) + " does not exist.");
+  const auto begin = _offsets[chunk_offset];
+  return {_compressed_values.data() + begin, _offsets[chunk_offset + 1] - begin};
+}
+
+template <typename T>
+std::string FSSTSegment<T>::compress(const std::string_view value) const {
+  auto compressed = std::string{};
+  _append_compressed(value, compressed);
+  return compressed;
+}
+
+template <typename T>
+size_t FSSTSegment<T>::symbol_count() const {
+  return _symbols.size();
+}
+
+template <typename T>
+ChunkOffset FSSTSegment<T>::size() const {
+  return static_cast<ChunkOffset>(_offsets.size() - 1);
+}
+
+template <typename T>
+DataType FSSTSegment<T>::data_type() const {
+  return data_type_of<T>;
+}
+
+template <typename T>
+SegmentType FSSTSegment<T>::segment_type() const {
+  return SegmentType::FSST;
+}
+
+template <typename T>
+size_t FSSTSegment<T>::estimate_memory_usage() const {
+  return sizeof(uint64_t) * _symbols.capacity() + sizeof(uint8_t) * _symbol_lengths.capacity() +
+         sizeof(_first_byte_codes) + _compressed_values.capacity() + sizeof(uint32_t) * _offsets.capacity() +
+         (_null_values.capacity() + 7) / 8;
+}
+
+template class FSSTSegment<std::string>;
+
+}  // namespace opossum
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+
+#include "abstract_segment.hpp"
+
+namespace opossum {
+
+// FSSTSegment is a specific segment type for string columns with many distinct values (e.g., free text), where a
+// dictionary does not help. Following FSST (Fast Static Symbol Table), it learns up to 255 frequent substrings of one
+// to eight bytes (symbols) from a sample of the segment and replaces every occurrence of a symbol by its one-byte
+// code. Bytes not covered by a symbol are stored as an escape code followed by the byte itself. Each value is
+// compressed on its own, so single values can be decompressed without touching their neighbors.
+//
+// Compression is deterministic, i.e., two values are equal if and only if their compressed forms are equal. Thus,
+// equality predicates can compress the search value once and compare compressed_value() without decompressing.
+// FSSTSegment is only defined for std::string.
+template <typename T>
+class FSSTSegment : public AbstractSegment {
+ public:
+  static_assert(std::is_same_v<T, std::string>, "FSSTSegment is only defined for std::string.");
+
+  /**
+   * Creates an FSST segment from a given value segment.
+   */
+  explicit FSSTSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns whether a value is NULL.
+  bool is_null(const ChunkOffset chunk_offset) const;
+
+  // Returns the compressed bytes of the value at a certain position. NULL values have no compressed bytes.
+  std::string_view compressed_value(const ChunkOffset chunk_offset) const;
+
+  // Compresses the given value with the symbol table of this segment. The result can be compared to
+  // compressed_value() to evaluate equality predicates on compressed data.
+  std::string compress(const std::string_view value) const;
+
+  // Returns the number of symbols in the symbol table.
+  size_t symbol_count() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  DataType data_type() const final;
+
+  SegmentType segment_type() const final;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+  // Code marking that the next byte is stored literally.
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // Maximum length of a symbol in bytes.
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+
+ protected:
+  void _compress(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Learns the symbol table from a sample of the given values.
+  void _build_symbol_table(const std::vector<std::string>& values, const std::vector<bool>& null_values);
+
+  // Replaces the symbol table with the given symbols, which have to be unique and hold one to eight bytes each.
+  void _set_symbols(std::vector<std::string> symbols);
+
+  // Returns the code of the longest symbol that is a prefix of the given data, or ESCAPE_CODE if there is none.
+  uint8_t _find_symbol(const char* data, const size_t length) const;
+
+  // Appends the compressed form of value to output.
+  template <typename Output>
+  void _append_compressed(const std::string_view value, Output& output) const;
+
+  // Symbols are stored as little-endian words padded with zeros. Codes are ordered by the first byte of their symbol
+  // and, for the same first byte, by descending length, so the longest match is the first match within
+  // [_first_byte_codes[byte], _first_byte_codes[byte + 1]).
+  std::vector<uint64_t> _symbols;
+  std::vector<uint8_t> _symbol_lengths;
+  std::array<uint16_t, 257> _first_byte_codes{};
+
+  // Compressed values stored back to back. The value at offset i spans [_offsets[i], _offsets[i + 1]).
+  std::vector<char> _compressed_values;
+  std::vector<uint32_t> _offsets;
+  std::vector<bool> _null_values;
+};
+
+extern template class FSSTSegment<std::string>;
+
+}  // namespace opossum
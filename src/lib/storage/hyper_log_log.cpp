@@ -0,0 +1,62 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog(const uint8_t precision) : _precision{precision}, _registers(size_t{1} << precision, 0) {
+  Assert(precision >= 7 && precision <= 18, "HyperLogLog precision must be between 7 and 18.");
+}
+
+void HyperLogLog::insert(const uint64_t hash) {
+  // The upper bits select the register, the remaining ones provide the leading zeros.
+  const auto register_index = hash >> (64 - _precision);
+  const auto remaining_bits = hash << _precision;
+  const auto max_rank = 64 - _precision + 1;
+  const auto rank = static_cast<uint8_t>(std::min(std::countl_zero(remaining_bits) + 1, max_rank));
+  _registers[register_index] = std::max(_registers[register_index], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  Assert(_precision == other._precision, "Cannot merge HyperLogLogs with different precisions.");
+  const auto register_count = _registers.size();
+  for (auto register_index = size_t{0}; register_index < register_count; ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+}
+
+size_t HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(_registers.size());
+  auto inverse_sum = 0.0;
+  auto empty_register_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -rank);
+    empty_register_count += rank == 0;
+  }
+
+  // Bias correction constant for at least 2^7 registers (Flajolet et al., 2007).
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // The raw estimate is biased for small cardinalities, for which linear counting over the empty registers is exact
+  // enough.
+  if (raw_estimate <= 2.5 * register_count && empty_register_count > 0) {
+    return static_cast<size_t>(
+        std::llround(register_count * std::log(register_count / static_cast<double>(empty_register_count))));
+  }
+  return static_cast<size_t>(std::llround(raw_estimate));
+}
+
+uint8_t HyperLogLog::precision() const {
+  return _precision;
+}
+
+size_t HyperLogLog::estimate_memory_usage() const {
+  return _registers.size() * sizeof(uint8_t);
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "utils/value_hash.hpp"
+
+namespace opossum {
+
+// HyperLogLog estimates the number of distinct values in a multiset within a few percent, using one byte per register
+// regardless of the number of values. Two sketches are merged by taking the register-wise maximum, which yields the
+// sketch of the union. Thus, per-chunk sketches combine into a table-wide distinct count without looking at the data
+// again, whereas exact per-chunk distinct counts cannot simply be added up.
+// The sketch works on 64-bit hashes; use value_hash() to hash values.
+class HyperLogLog {
+ public:
+  // Creates an empty sketch with 2^precision registers. The standard error is about 1.04 / sqrt(2^precision), i.e.,
+  // about three percent for the default.
+  explicit HyperLogLog(const uint8_t precision = 10);
+
+  void insert(const uint64_t hash);
+
+  // Adds all values of another sketch with the same precision to this one.
+  void merge(const HyperLogLog& other);
+
+  // Returns the estimated number of distinct values inserted.
+  size_t estimate() const;
+
+  uint8_t precision() const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+ protected:
+  uint8_t _precision;
+  // Per register, one plus the maximum number of leading zeros of the hashes mapped to it.
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
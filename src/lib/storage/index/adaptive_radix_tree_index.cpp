@@ -0,0 +1,182 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Maps a number to an unsigned integer of the same width whose order equals the order of the numbers.
+template <typename T>
+auto ordered_bits(const T value) {
+  using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+  constexpr auto SIGN_BIT = Bits{1} << (sizeof(T) * 8 - 1);
+  if constexpr (std::is_floating_point_v<T>) {
+    // -0.0 == 0.0, so both must have the same key.
+    const auto bits = std::bit_cast<Bits>(value == T{0} ? T{0} : value);
+    // Negative numbers are ordered inversely to their bits, positive numbers like their bits.
+    return (bits & SIGN_BIT) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | SIGN_BIT);
+  } else {
+    return static_cast<Bits>(static_cast<Bits>(value) ^ SIGN_BIT);
+  }
+}
+
+// Orders values like their ARTKeys.
+template <typename T>
+bool key_less(const T& left, const T& right) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return ordered_bits(left) < ordered_bits(right);
+  } else {
+    return left < right;
+  }
+}
+
+}  // namespace
+
+template <typename T>
+ARTKey encode_art_key(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto key = ARTKey{};
+    key.reserve(value.size() + 2);
+    for (const auto character : value) {
+      const auto byte = static_cast<uint8_t>(character);
+      key.push_back(byte);
+      // Zero bytes become 0x00 0xFF, so that they are larger than the terminator 0x00 0x00.
+      if (byte == 0) {
+        key.push_back(0xFF);
+      }
+    }
+    key.push_back(0);
+    key.push_back(0);
+    return key;
+  } else {
+    const auto bits = ordered_bits(value);
+    auto key = ARTKey(sizeof(T));
+    for (auto byte_index = size_t{0}; byte_index < sizeof(T); ++byte_index) {
+      key[byte_index] = static_cast<uint8_t>(bits >> (8 * (sizeof(T) - 1 - byte_index)));
+    }
+    return key;
+  }
+}
+
+template ARTKey encode_art_key<int32_t>(const int32_t& value);
+template ARTKey encode_art_key<int64_t>(const int64_t& value);
+template ARTKey encode_art_key<float>(const float& value);
+template ARTKey encode_art_key<double>(const double& value);
+template ARTKey encode_art_key<std::string>(const std::string& value);
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(
+    const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex{SegmentIndexType::AdaptiveRadixTree},
+      _indexed_segment{segments_to_index.size() == 1 ? segments_to_index.front() : nullptr} {
+  Assert(_indexed_segment, "AdaptiveRadixTreeIndex only works with a single segment.");
+
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto entries = std::vector<std::pair<ColumnDataType, ChunkOffset>>{};
+    entries.reserve(_indexed_segment->size());
+    segment_iterate<ColumnDataType>(*_indexed_segment, [&](const auto& position) {
+      if (position.is_null()) {
+        _null_positions.push_back(position.chunk_offset());
+      } else if (!is_nan(position.value())) {
+        // NaN rows are left out like NULLs, since no range of values contains them.
+        entries.emplace_back(position.value(), position.chunk_offset());
+      }
+    });
+    std::sort(entries.begin(), entries.end(), [](const auto& left, const auto& right) {
+      if (key_less(left.first, right.first)) {
+        return true;
+      }
+      return !key_less(right.first, left.first) && left.second < right.second;
+    });
+
+    // Create a leaf for each distinct value, which covers the positions of all its occurrences.
+    const auto entry_count = entries.size();
+    _chunk_offsets.resize(entry_count);
+    auto leaves = std::vector<std::unique_ptr<ARTLeaf>>{};
+    auto value_begin = size_t{0};
+    for (auto entry_index = size_t{0}; entry_index < entry_count; ++entry_index) {
+      _chunk_offsets[entry_index] = entries[entry_index].second;
+      const auto is_last_of_value =
+          entry_index + 1 == entry_count || key_less(entries[entry_index].first, entries[entry_index + 1].first);
+      if (is_last_of_value) {
+        leaves.push_back(std::make_unique<ARTLeaf>(encode_art_key(entries[entry_index].first),
+                                                   static_cast<ChunkOffset>(value_begin),
+                                                   static_cast<ChunkOffset>(entry_index + 1)));
+        value_begin = entry_index + 1;
+      }
+    }
+
+    if (!leaves.empty()) {
+      _root = ARTInnerNode::build(leaves, 0, leaves.size(), 0);
+    }
+  });
+}
+
+AdaptiveRadixTreeIndex::~AdaptiveRadixTreeIndex() = default;
+
+size_t AdaptiveRadixTreeIndex::estimate_memory_usage() const {
+  return sizeof(ChunkOffset) * (_chunk_offsets.capacity() + _null_positions.capacity()) +
+         (_root ? _root->estimate_memory_usage() : 0);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (!_root || _is_nan(values.front())) {
+    return _chunk_offsets.cend();
+  }
+  const auto* leaf = _root->lower_bound(_encode_search_value(values.front()), 0);
+  return leaf ? _chunk_offsets.cbegin() + leaf->begin() : _chunk_offsets.cend();
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (!_root || _is_nan(values.front())) {
+    return _chunk_offsets.cend();
+  }
+  const auto key = _encode_search_value(values.front());
+  const auto* leaf = _root->lower_bound(key, 0);
+  if (!leaf) {
+    return _chunk_offsets.cend();
+  }
+  // The positions of the next larger value directly follow those of the search value.
+  return _chunk_offsets.cbegin() + (leaf->key() == key ? leaf->end() : leaf->begin());
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const {
+  return _chunk_offsets.cbegin();
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const {
+  return _chunk_offsets.cend();
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> AdaptiveRadixTreeIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+bool AdaptiveRadixTreeIndex::_is_nan(const AllTypeVariant& value) const {
+  auto result = false;
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    result = is_nan(type_cast<ColumnDataType>(value));
+  });
+  return result;
+}
+
+ARTKey AdaptiveRadixTreeIndex::_encode_search_value(const AllTypeVariant& value) const {
+  auto key = ARTKey{};
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    key = encode_art_key(type_cast<ColumnDataType>(value));
+  });
+  return key;
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+class ARTNode;
+
+// A binary-comparable key: the lexicographical (unsigned byte) order of keys equals the order of the encoded values.
+using ARTKey = std::vector<uint8_t>;
+
+// Encodes a value as an ARTKey. Integers are stored big-endian with a flipped sign bit. Floating-point numbers follow
+// the IEEE 754 total order, with -0.0 normalized to 0.0 so that both compare equal. Strings escape zero bytes and end
+// with two zero bytes, so that no key is a prefix of another.
+template <typename T>
+ARTKey encode_art_key(const T& value);
+
+// AdaptiveRadixTreeIndex indexes a single segment of any type and encoding (Leis et al.: "The Adaptive Radix Tree:
+// ARTful Indexing for Main-Memory Databases", ICDE 2013). Unlike the GroupKeyIndex, it does not depend on a
+// dictionary, so it also serves ValueSegments and other encodings. The tree maps the binary-comparable key of each
+// distinct value to the range of its chunk offsets in _chunk_offsets, which holds the offsets of all non-NULL rows
+// sorted by value. NaN rows are left out of _chunk_offsets like NULLs, so no range reaches them. A NaN search value has
+// no equal values, and both of its bounds are cend(). Inner nodes have 4, 16, 48, or 256 children depending on their
+// fan-out, and store the common prefix of their keys (path compression), so lookups take O(key length) regardless of
+// the number of rows.
+// The segment must not be modified after the index was created.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  // Creates an index over a single segment.
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  ~AdaptiveRadixTreeIndex() override;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+
+  bool _is_nan(const AllTypeVariant& value) const;
+
+  // Returns the binary-comparable key of a search value.
+  ARTKey _encode_search_value(const AllTypeVariant& value) const;
+
+  const std::shared_ptr<const AbstractSegment> _indexed_segment;
+  std::vector<ChunkOffset> _chunk_offsets;
+  // nullptr if the segment holds no non-NULL values
+  std::unique_ptr<ARTNode> _root;
+};
+
+}  // namespace opossum
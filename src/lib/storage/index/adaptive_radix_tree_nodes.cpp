@@ -0,0 +1,243 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ARTLeaf::ARTLeaf(ARTKey key, const ChunkOffset begin, const ChunkOffset end)
+    : _key{std::move(key)}, _begin{begin}, _end{end} {}
+
+const ARTLeaf* ARTLeaf::lower_bound(const ARTKey& key, const size_t depth) const {
+  return _key < key ? nullptr : this;
+}
+
+const ARTLeaf* ARTLeaf::min_leaf() const {
+  return this;
+}
+
+size_t ARTLeaf::estimate_memory_usage() const {
+  return sizeof(*this) + _key.capacity();
+}
+
+const ARTKey& ARTLeaf::key() const {
+  return _key;
+}
+
+ChunkOffset ARTLeaf::begin() const {
+  return _begin;
+}
+
+ChunkOffset ARTLeaf::end() const {
+  return _end;
+}
+
+ARTInnerNode::ARTInnerNode(ARTKey prefix) : _prefix{std::move(prefix)} {}
+
+const ARTLeaf* ARTInnerNode::lower_bound(const ARTKey& key, const size_t depth) const {
+  const auto prefix_size = _prefix.size();
+  for (auto prefix_index = size_t{0}; prefix_index < prefix_size; ++prefix_index) {
+    // If the search key ends within the prefix, it is a prefix of (and thus smaller than) all keys of the subtree.
+    if (depth + prefix_index >= key.size()) {
+      return min_leaf();
+    }
+    const auto key_byte = key[depth + prefix_index];
+    if (_prefix[prefix_index] < key_byte) {
+      return nullptr;
+    }
+    if (_prefix[prefix_index] > key_byte) {
+      return min_leaf();
+    }
+  }
+
+  const auto child_depth = depth + prefix_size;
+  if (child_depth >= key.size()) {
+    return min_leaf();
+  }
+  const auto key_byte = key[child_depth];
+  if (const auto* child = _child(key_byte)) {
+    if (const auto* leaf = child->lower_bound(key, child_depth + 1)) {
+      return leaf;
+    }
+  }
+  // All keys of the matching child are smaller, so the result is the smallest key of the next child.
+  const auto* next_child = _next_child(key_byte);
+  return next_child ? next_child->min_leaf() : nullptr;
+}
+
+const ARTLeaf* ARTInnerNode::min_leaf() const {
+  return _first_child()->min_leaf();
+}
+
+std::unique_ptr<ARTNode> ARTInnerNode::build(std::vector<std::unique_ptr<ARTLeaf>>& leaves, const size_t begin,
+                                             const size_t end, const size_t depth) {
+  if (end - begin == 1) {
+    return std::move(leaves[begin]);
+  }
+
+  // The leaves are sorted, so the first and the last one share the prefix of all leaves. They are distinct and not a
+  // prefix of each other, so they differ before either ends.
+  const auto& first_key = leaves[begin]->key();
+  const auto& last_key = leaves[end - 1]->key();
+  auto child_depth = depth;
+  while (first_key[child_depth] == last_key[child_depth]) {
+    ++child_depth;
+  }
+  auto prefix = ARTKey(first_key.begin() + static_cast<ptrdiff_t>(depth),
+                       first_key.begin() + static_cast<ptrdiff_t>(child_depth));
+
+  // Leaves with the same byte at child_depth belong to the same child.
+  auto child_begins = std::vector<size_t>{};
+  for (auto leaf_index = begin; leaf_index < end; ++leaf_index) {
+    if (leaf_index == begin || leaves[leaf_index]->key()[child_depth] != leaves[leaf_index - 1]->key()[child_depth]) {
+      child_begins.push_back(leaf_index);
+    }
+  }
+  child_begins.push_back(end);
+
+  const auto child_count = child_begins.size() - 1;
+  auto node = std::unique_ptr<ARTInnerNode>{};
+  if (child_count <= 4) {
+    node = std::make_unique<ARTNode4>(std::move(prefix));
+  } else if (child_count <= 16) {
+    node = std::make_unique<ARTNode16>(std::move(prefix));
+  } else if (child_count <= 48) {
+    node = std::make_unique<ARTNode48>(std::move(prefix));
+  } else {
+    node = std::make_unique<ARTNode256>(std::move(prefix));
+  }
+
+  for (auto child_index = size_t{0}; child_index < child_count; ++child_index) {
+    const auto child_begin = child_begins[child_index];
+    const auto key_byte = leaves[child_begin]->key()[child_depth];
+    node->add_child(key_byte, build(leaves, child_begin, child_begins[child_index + 1], child_depth + 1));
+  }
+  return node;
+}
+
+template <size_t Capacity>
+ARTSortedNode<Capacity>::ARTSortedNode(ARTKey prefix) : ARTInnerNode{std::move(prefix)} {}
+
+template <size_t Capacity>
+void ARTSortedNode<Capacity>::add_child(const uint8_t key_byte, std::unique_ptr<ARTNode> child) {
+  DebugAssert(_child_count < Capacity, "Node is full.");
+  DebugAssert(_child_count == 0 || _key_bytes[_child_count - 1] < key_byte, "Children must be added in order.");
+  _key_bytes[_child_count] = key_byte;
+  _children[_child_count] = std::move(child);
+  ++_child_count;
+}
+
+template <size_t Capacity>
+size_t ARTSortedNode<Capacity>::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _prefix.capacity();
+  for (auto child_index = size_t{0}; child_index < _child_count; ++child_index) {
+    memory_usage += _children[child_index]->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+template <size_t Capacity>
+const ARTNode* ARTSortedNode<Capacity>::_child(const uint8_t key_byte) const {
+  for (auto child_index = size_t{0}; child_index < _child_count; ++child_index) {
+    if (_key_bytes[child_index] == key_byte) {
+      return _children[child_index].get();
+    }
+  }
+  return nullptr;
+}
+
+template <size_t Capacity>
+const ARTNode* ARTSortedNode<Capacity>::_next_child(const uint8_t key_byte) const {
+  for (auto child_index = size_t{0}; child_index < _child_count; ++child_index) {
+    if (_key_bytes[child_index] > key_byte) {
+      return _children[child_index].get();
+    }
+  }
+  return nullptr;
+}
+
+template <size_t Capacity>
+const ARTNode* ARTSortedNode<Capacity>::_first_child() const {
+  return _children[0].get();
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+ARTNode48::ARTNode48(ARTKey prefix) : ARTInnerNode{std::move(prefix)} {
+  _slots.fill(EMPTY_SLOT);
+}
+
+void ARTNode48::add_child(const uint8_t key_byte, std::unique_ptr<ARTNode> child) {
+  DebugAssert(_child_count < _children.size(), "Node is full.");
+  _slots[key_byte] = _child_count;
+  _children[_child_count] = std::move(child);
+  ++_child_count;
+}
+
+size_t ARTNode48::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _prefix.capacity();
+  for (auto child_index = size_t{0}; child_index < _child_count; ++child_index) {
+    memory_usage += _children[child_index]->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+const ARTNode* ARTNode48::_child(const uint8_t key_byte) const {
+  const auto slot = _slots[key_byte];
+  return slot == EMPTY_SLOT ? nullptr : _children[slot].get();
+}
+
+const ARTNode* ARTNode48::_next_child(const uint8_t key_byte) const {
+  for (auto next_key_byte = size_t{key_byte} + 1; next_key_byte < _slots.size(); ++next_key_byte) {
+    const auto slot = _slots[next_key_byte];
+    if (slot != EMPTY_SLOT) {
+      return _children[slot].get();
+    }
+  }
+  return nullptr;
+}
+
+const ARTNode* ARTNode48::_first_child() const {
+  // Children are added in order of their key bytes.
+  return _children[0].get();
+}
+
+ARTNode256::ARTNode256(ARTKey prefix) : ARTInnerNode{std::move(prefix)} {}
+
+void ARTNode256::add_child(const uint8_t key_byte, std::unique_ptr<ARTNode> child) {
+  _children[key_byte] = std::move(child);
+}
+
+size_t ARTNode256::estimate_memory_usage() const {
+  auto memory_usage = sizeof(*this) + _prefix.capacity();
+  for (const auto& child : _children) {
+    if (child) {
+      memory_usage += child->estimate_memory_usage();
+    }
+  }
+  return memory_usage;
+}
+
+const ARTNode* ARTNode256::_child(const uint8_t key_byte) const {
+  return _children[key_byte].get();
+}
+
+const ARTNode* ARTNode256::_next_child(const uint8_t key_byte) const {
+  for (auto next_key_byte = size_t{key_byte} + 1; next_key_byte < _children.size(); ++next_key_byte) {
+    if (_children[next_key_byte]) {
+      return _children[next_key_byte].get();
+    }
+  }
+  return nullptr;
+}
+
+const ARTNode* ARTNode256::_first_child() const {
+  for (const auto& child : _children) {
+    if (child) {
+      return child.get();
+    }
+  }
+  Fail("Inner nodes have at least two children.");
+}
+
+}  // namespace opossum
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "adaptive_radix_tree_index.hpp"
+
+namespace opossum {
+
+class ARTLeaf;
+
+// Node of an AdaptiveRadixTreeIndex. All lookups are lower bounds: point and range lookups are answered from the
+// first leaf whose key is not smaller than the search key.
+class ARTNode : private Noncopyable {
+ public:
+  virtual ~ARTNode() = default;
+
+  // Returns the leftmost leaf of this subtree whose key is >= key, or nullptr if there is none. depth is the number of
+  // key bytes consumed by the ancestors of the node.
+  virtual const ARTLeaf* lower_bound(const ARTKey& key, const size_t depth) const = 0;
+
+  // Returns the leftmost leaf of this subtree.
+  virtual const ARTLeaf* min_leaf() const = 0;
+
+  // Returns the calculated memory usage of this subtree.
+  virtual size_t estimate_memory_usage() const = 0;
+};
+
+// Leaf holding the full key of one distinct value and the range [begin, end) of its positions in the index.
+class ARTLeaf final : public ARTNode {
+ public:
+  ARTLeaf(ARTKey key, const ChunkOffset begin, const ChunkOffset end);
+
+  const ARTLeaf* lower_bound(const ARTKey& key, const size_t depth) const final;
+  const ARTLeaf* min_leaf() const final;
+  size_t estimate_memory_usage() const final;
+
+  const ARTKey& key() const;
+  ChunkOffset begin() const;
+  ChunkOffset end() const;
+
+ protected:
+  const ARTKey _key;
+  const ChunkOffset _begin;
+  const ChunkOffset _end;
+};
+
+// Inner node with a compressed path prefix. The concrete node types only differ in how they map the next key byte to
+// a child.
+class ARTInnerNode : public ARTNode {
+ public:
+  const ARTLeaf* lower_bound(const ARTKey& key, const size_t depth) const final;
+  const ARTLeaf* min_leaf() const final;
+
+  // Adds a child. Children must be added in ascending order of their key bytes.
+  virtual void add_child(const uint8_t key_byte, std::unique_ptr<ARTNode> child) = 0;
+
+  // Builds a (sub)tree over leaves sorted by their keys, none of which is a prefix of another. depth is the number of
+  // key bytes that all leaves share and that are consumed by ancestors.
+  static std::unique_ptr<ARTNode> build(std::vector<std::unique_ptr<ARTLeaf>>& leaves, const size_t begin,
+                                        const size_t end, const size_t depth);
+
+ protected:
+  explicit ARTInnerNode(ARTKey prefix);
+
+  // Returns the child for the key byte, or nullptr.
+  virtual const ARTNode* _child(const uint8_t key_byte) const = 0;
+  // Returns the child with the smallest key byte larger than the given one, or nullptr.
+  virtual const ARTNode* _next_child(const uint8_t key_byte) const = 0;
+  virtual const ARTNode* _first_child() const = 0;
+
+  const ARTKey _prefix;
+};
+
+// Node with up to Capacity children (4 or 16), whose key bytes are kept in a sorted array.
+template <size_t Capacity>
+class ARTSortedNode final : public ARTInnerNode {
+ public:
+  explicit ARTSortedNode(ARTKey prefix);
+
+  void add_child(const uint8_t key_byte, std::unique_ptr<ARTNode> child) final;
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const ARTNode* _child(const uint8_t key_byte) const final;
+  const ARTNode* _next_child(const uint8_t key_byte) const final;
+  const ARTNode* _first_child() const final;
+
+  uint8_t _child_count{0};
+  std::array<uint8_t, Capacity> _key_bytes{};
+  std::array<std::unique_ptr<ARTNode>, Capacity> _children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+// Node with up to 48 children, which maps each key byte to a slot of the children array.
+class ARTNode48 final : public ARTInnerNode {
+ public:
+  explicit ARTNode48(ARTKey prefix);
+
+  void add_child(const uint8_t key_byte, std::unique_ptr<ARTNode> child) final;
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const ARTNode* _child(const uint8_t key_byte) const final;
+  const ARTNode* _next_child(const uint8_t key_byte) const final;
+  const ARTNode* _first_child() const final;
+
+  static constexpr auto EMPTY_SLOT = uint8_t{255};
+
+  uint8_t _child_count{0};
+  std::array<uint8_t, 256> _slots;
+  std::array<std::unique_ptr<ARTNode>, 48> _children;
+};
+
+// Node with a child pointer for each possible key byte.
+class ARTNode256 final : public ARTInnerNode {
+ public:
+  explicit ARTNode256(ARTKey prefix);
+
+  void add_child(const uint8_t key_byte, std::unique_ptr<ARTNode> child) final;
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  const ARTNode* _child(const uint8_t key_byte) const final;
+  const ARTNode* _next_child(const uint8_t key_byte) const final;
+  const ARTNode* _first_child() const final;
+
+  std::array<std::unique_ptr<ARTNode>, 256> _children;
+};
+
+}  // namespace opossum
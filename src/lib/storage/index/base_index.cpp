@@ -0,0 +1,60 @@
+#include "base_index.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+void assert_search_values(const std::vector<AllTypeVariant>& values, const size_t indexed_segment_count) {
+  Assert(!values.empty() && values.size() <= indexed_segment_count,
+         "Number of search values must be between one and the number of indexed segments.");
+  Assert(std::none_of(values.begin(), values.end(), variant_is_null),
+         "Cannot search for NULL, use null_cbegin() and null_cend() instead.");
+}
+
+}  // namespace
+
+BaseIndex::BaseIndex(const SegmentIndexType type) : _type{type} {}
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
+  return _get_indexed_segments() == segments;
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  assert_search_values(values, _get_indexed_segments().size());
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  assert_search_values(values, _get_indexed_segments().size());
+  return _upper_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const {
+  return _cbegin();
+}
+
+BaseIndex::Iterator BaseIndex::cend() const {
+  return _cend();
+}
+
+BaseIndex::Iterator BaseIndex::null_cbegin() const {
+  return _null_positions.cbegin();
+}
+
+BaseIndex::Iterator BaseIndex::null_cend() const {
+  return _null_positions.cend();
+}
+
+SegmentIndexType BaseIndex::type() const {
+  return _type;
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> BaseIndex::get_indexed_segments() const {
+  return _get_indexed_segments();
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// Concrete index classes, see BaseIndex::type.
+enum class SegmentIndexType { GroupKey, AdaptiveRadixTree, Composite };
+
+// BaseIndex is the abstract super class of all secondary indexes over one or more segments of a Chunk. An index
+// provides the chunk offsets of all non-NULL rows, ordered by their values, so that the rows matching a predicate form
+// a contiguous range [lower_bound, upper_bound) that is found without reading the segments. Rows with equal values are
+// ordered by their chunk offset. Multi-column indexes order rows lexicographically by their values.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  virtual ~BaseIndex() = default;
+
+  // Returns whether the index covers exactly the given segments, in this order.
+  bool is_index_for(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
+
+  // Returns an iterator to the first position whose values are not smaller than the search values. Fewer search values
+  // than indexed segments act as a prefix.
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns an iterator to the first position whose values are larger than the search values. Fewer search values
+  // than indexed segments act as a prefix.
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // Return the range of all non-NULL positions, ordered by value.
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+  // Return the range of all positions where any indexed value is NULL, ordered by chunk offset.
+  Iterator null_cbegin() const;
+  Iterator null_cend() const;
+
+  SegmentIndexType type() const;
+
+  // Returns the indexed segments, in the order of the index's columns.
+  std::vector<std::shared_ptr<const AbstractSegment>> get_indexed_segments() const;
+
+  // Returns the calculated memory usage.
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  explicit BaseIndex(const SegmentIndexType type);
+
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+  virtual std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const = 0;
+
+  std::vector<ChunkOffset> _null_positions;
+
+ private:
+  const SegmentIndexType _type;
+};
+
+}  // namespace opossum
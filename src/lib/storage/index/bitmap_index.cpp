@@ -0,0 +1,115 @@
+#include "bitmap_index.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "type_cast.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BitmapIndex::BitmapIndex(const std::shared_ptr<const AbstractSegment>& segment) : _indexed_segment{segment} {
+  Assert(_indexed_segment && _indexed_segment->segment_type() == SegmentType::Dictionary,
+         "BitmapIndex only works with DictionarySegments.");
+
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto& dictionary_segment = static_cast<const DictionarySegment<ColumnDataType>&>(*_indexed_segment);
+    const auto null_value_id = dictionary_segment.null_value_id();
+    _value_bitmaps.resize(dictionary_segment.unique_values_count());
+
+    // Visiting the rows in order adds the chunk offsets to each bitmap in ascending order.
+    dictionary_segment.attribute_vector()->for_each_block(
+        [&](const size_t first_index, const std::span<const ValueID> value_ids) {
+          const auto value_id_count = value_ids.size();
+          for (auto index = size_t{0}; index < value_id_count; ++index) {
+            const auto value_id = value_ids[index];
+            const auto chunk_offset = static_cast<ChunkOffset>(first_index + index);
+            if (value_id == null_value_id) {
+              _null_bitmap.add(chunk_offset);
+            } else {
+              _value_bitmaps[value_id].add(chunk_offset);
+            }
+          }
+        });
+  });
+
+  for (auto& value_bitmap : _value_bitmaps) {
+    value_bitmap.shrink_to_fit();
+  }
+  _null_bitmap.shrink_to_fit();
+}
+
+RoaringBitmap BitmapIndex::bitmap(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  if (variant_is_null(search_value)) {
+    return RoaringBitmap{};
+  }
+
+  // The ValueIDs of the values equal to the search value are [lower, upper). Stored NaNs have the last ValueID, which
+  // is not ordered against the others.
+  const auto value_count = ValueID{static_cast<ValueID::base_type>(_value_bitmaps.size())};
+  auto ordered_value_count = value_count;
+  auto lower = INVALID_VALUE_ID;
+  auto upper = INVALID_VALUE_ID;
+  auto search_is_nan = false;
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto& dictionary_segment = static_cast<const DictionarySegment<ColumnDataType>&>(*_indexed_segment);
+    if (dictionary_segment.nan_value_id() != INVALID_VALUE_ID) {
+      ordered_value_count = dictionary_segment.nan_value_id();
+    }
+    const auto typed_search_value = type_cast<ColumnDataType>(search_value);
+    search_is_nan = is_nan(typed_search_value);
+    lower = dictionary_segment.lower_bound(typed_search_value);
+    upper = dictionary_segment.upper_bound(typed_search_value);
+  });
+  // NaN is neither smaller, equal, nor larger than any value, so it only satisfies OpNotEquals, for all non-NULL rows.
+  if (search_is_nan) {
+    return scan_type == ScanType::OpNotEquals ? _bitmap_for_range(ValueID{0}, value_count) : RoaringBitmap{};
+  }
+  lower = lower == INVALID_VALUE_ID ? ordered_value_count : lower;
+  upper = upper == INVALID_VALUE_ID ? ordered_value_count : upper;
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return _bitmap_for_range(lower, upper);
+    case ScanType::OpNotEquals:
+      return _bitmap_for_range(ValueID{0}, lower) | _bitmap_for_range(upper, value_count);
+    case ScanType::OpLessThan:
+      return _bitmap_for_range(ValueID{0}, lower);
+    case ScanType::OpLessThanEquals:
+      return _bitmap_for_range(ValueID{0}, upper);
+    case ScanType::OpGreaterThan:
+      return _bitmap_for_range(upper, ordered_value_count);
+    case ScanType::OpGreaterThanEquals:
+      return _bitmap_for_range(lower, ordered_value_count);
+  }
+  Fail("Unknown scan type.");
+}
+
+const RoaringBitmap& BitmapIndex::null_bitmap() const {
+  return _null_bitmap;
+}
+
+const std::shared_ptr<const AbstractSegment>& BitmapIndex::indexed_segment() const {
+  return _indexed_segment;
+}
+
+size_t BitmapIndex::estimate_memory_usage() const {
+  auto memory_usage = sizeof(RoaringBitmap) * _value_bitmaps.capacity() + _null_bitmap.estimate_memory_usage();
+  for (const auto& value_bitmap : _value_bitmaps) {
+    memory_usage += value_bitmap.estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+RoaringBitmap BitmapIndex::_bitmap_for_range(const ValueID begin, const ValueID end) const {
+  auto result = RoaringBitmap{};
+  for (auto value_id = begin; value_id < end; ++value_id) {
+    result |= _value_bitmaps[value_id];
+  }
+  return result;
+}
+
+}  // namespace opossum
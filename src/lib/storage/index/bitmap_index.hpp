@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "roaring_bitmap.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// BitmapIndex indexes a DictionarySegment of a low-cardinality column (e.g., a country or status column) with one
+// RoaringBitmap of chunk offsets per ValueID. The rows matching a predicate are the union of the bitmaps of the
+// matching ValueIDs, and the results of several predicates are combined with bitmap intersections and unions before
+// any position list is materialized (see BitmapScan).
+//
+// Unlike the indexes derived from BaseIndex, it does not list the chunk offsets ordered by value. Providing them would
+// require an uncompressed copy of all chunk offsets, which is what the bitmaps avoid. With many distinct values, the
+// bitmaps become sparse and a GroupKeyIndex is the better choice, so Table::compress_chunk only creates bitmap indexes
+// for columns with at most MAX_DISTINCT_VALUE_COUNT distinct values.
+class BitmapIndex : private Noncopyable {
+ public:
+  // Creates an index over a DictionarySegment.
+  explicit BitmapIndex(const std::shared_ptr<const AbstractSegment>& segment);
+
+  // Returns the chunk offsets of the rows for which "value <scan_type> search_value" holds. NULLs never match.
+  RoaringBitmap bitmap(const ScanType scan_type, const AllTypeVariant& search_value) const;
+
+  // Returns the chunk offsets of the NULLs.
+  const RoaringBitmap& null_bitmap() const;
+
+  // Returns the indexed segment.
+  const std::shared_ptr<const AbstractSegment>& indexed_segment() const;
+
+  size_t estimate_memory_usage() const;
+
+  static constexpr auto MAX_DISTINCT_VALUE_COUNT = size_t{64};
+
+ protected:
+  // Returns the union of the bitmaps of the ValueIDs in [begin, end).
+  RoaringBitmap _bitmap_for_range(const ValueID begin, const ValueID end) const;
+
+  const std::shared_ptr<const AbstractSegment> _indexed_segment;
+  // Chunk offsets of the rows per ValueID
+  std::vector<RoaringBitmap> _value_bitmaps;
+  RoaringBitmap _null_bitmap;
+};
+
+}  // namespace opossum
@@ -0,0 +1,169 @@
+#include "composite_index.hpp"
+
+#include <algorithm>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_comparison.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the first index in [0, count) for which predicate is false, where predicate is true for a prefix of indexes.
+template <typename Predicate>
+size_t partition_point(const size_t count, const Predicate& predicate) {
+  auto low = size_t{0};
+  auto high = count;
+  while (low < high) {
+    const auto middle = low + (high - low) / 2;
+    if (predicate(middle)) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+}  // namespace
+
+CompositeIndex::CompositeIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex{SegmentIndexType::Composite}, _indexed_segments{segments_to_index} {
+  Assert(!_indexed_segments.empty(), "CompositeIndex needs at least one segment.");
+  const auto row_count = _indexed_segments.front()->size();
+  Assert(std::all_of(_indexed_segments.begin(), _indexed_segments.end(),
+                     [&](const auto& segment) { return segment->size() == row_count; }),
+         "Indexed segments must have the same size.");
+
+  // Build the key of each row column by column.
+  auto row_keys = std::vector<ARTKey>(row_count);
+  auto row_is_null = std::vector<bool>(row_count);
+  auto row_is_nan = std::vector<bool>(row_count);
+  for (const auto& segment : _indexed_segments) {
+    resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+        const auto chunk_offset = position.chunk_offset();
+        if (position.is_null()) {
+          row_is_null[chunk_offset] = true;
+        } else if (is_nan(position.value())) {
+          row_is_nan[chunk_offset] = true;
+        } else if (!row_is_null[chunk_offset] && !row_is_nan[chunk_offset]) {
+          const auto key = encode_art_key(position.value());
+          row_keys[chunk_offset].insert(row_keys[chunk_offset].end(), key.begin(), key.end());
+        }
+      });
+    });
+  }
+
+  _chunk_offsets.reserve(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (row_is_null[chunk_offset]) {
+      _null_positions.push_back(chunk_offset);
+    } else if (row_is_nan[chunk_offset]) {
+      _nan_positions.push_back(chunk_offset);
+    } else {
+      _chunk_offsets.push_back(chunk_offset);
+    }
+  }
+  std::sort(_chunk_offsets.begin(), _chunk_offsets.end(), [&](const auto left, const auto right) {
+    const auto comparison = row_keys[left] <=> row_keys[right];
+    return comparison < 0 || (comparison == 0 && left < right);
+  });
+
+  // Store each distinct key once.
+  const auto chunk_offset_count = _chunk_offsets.size();
+  for (auto position = size_t{0}; position < chunk_offset_count; ++position) {
+    const auto& key = row_keys[_chunk_offsets[position]];
+    if (position == 0 || key != row_keys[_chunk_offsets[position - 1]]) {
+      _key_begins.push_back(_keys.size());
+      _key_positions.push_back(static_cast<ChunkOffset>(position));
+      _keys.insert(_keys.end(), key.begin(), key.end());
+    }
+  }
+  _key_begins.push_back(_keys.size());
+  _key_positions.push_back(static_cast<ChunkOffset>(chunk_offset_count));
+}
+
+size_t CompositeIndex::estimate_memory_usage() const {
+  return _keys.capacity() + sizeof(size_t) * _key_begins.capacity() +
+         sizeof(ChunkOffset) * (_chunk_offsets.capacity() + _key_positions.capacity() + _null_positions.capacity() +
+                                _nan_positions.capacity());
+}
+
+const std::vector<ChunkOffset>& CompositeIndex::nan_positions() const {
+  return _nan_positions;
+}
+
+BaseIndex::Iterator CompositeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (_contains_nan(values)) {
+    return _chunk_offsets.cend();
+  }
+  const auto search_key = _encode_search_values(values);
+  const auto key_index = partition_point(_key_begins.size() - 1, [&](const auto index) {
+    const auto key = _key(index);
+    return std::lexicographical_compare(key.begin(), key.end(), search_key.begin(), search_key.end());
+  });
+  return _chunk_offsets.cbegin() + _key_positions[key_index];
+}
+
+BaseIndex::Iterator CompositeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (_contains_nan(values)) {
+    return _chunk_offsets.cend();
+  }
+  const auto search_key = _encode_search_values(values);
+  // Keys that start with the search key (i.e., rows matching a prefix lookup) directly follow the smaller keys. Search
+  // keys consist of complete column keys, so a key that equals the search key on their common length starts with it.
+  const auto key_index = partition_point(_key_begins.size() - 1, [&](const auto index) {
+    const auto key = _key(index);
+    const auto common_size = static_cast<ptrdiff_t>(std::min(key.size(), search_key.size()));
+    return std::lexicographical_compare_three_way(key.begin(), key.begin() + common_size, search_key.begin(),
+                                                  search_key.begin() + common_size) <= 0;
+  });
+  return _chunk_offsets.cbegin() + _key_positions[key_index];
+}
+
+BaseIndex::Iterator CompositeIndex::_cbegin() const {
+  return _chunk_offsets.cbegin();
+}
+
+BaseIndex::Iterator CompositeIndex::_cend() const {
+  return _chunk_offsets.cend();
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> CompositeIndex::_get_indexed_segments() const {
+  return _indexed_segments;
+}
+
+ARTKey CompositeIndex::_encode_search_values(const std::vector<AllTypeVariant>& values) const {
+  auto search_key = ARTKey{};
+  const auto value_count = values.size();
+  for (auto column_index = size_t{0}; column_index < value_count; ++column_index) {
+    resolve_data_type(_indexed_segments[column_index]->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto key = encode_art_key(type_cast<ColumnDataType>(values[column_index]));
+      search_key.insert(search_key.end(), key.begin(), key.end());
+    });
+  }
+  return search_key;
+}
+
+bool CompositeIndex::_contains_nan(const std::vector<AllTypeVariant>& values) const {
+  auto result = false;
+  const auto value_count = values.size();
+  for (auto column_index = size_t{0}; column_index < value_count; ++column_index) {
+    resolve_data_type(_indexed_segments[column_index]->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      result |= is_nan(type_cast<ColumnDataType>(values[column_index]));
+    });
+  }
+  return result;
+}
+
+std::span<const uint8_t> CompositeIndex::_key(const size_t key_index) const {
+  return {_keys.data() + _key_begins[key_index], _keys.data() + _key_begins[key_index + 1]};
+}
+
+}  // namespace opossum
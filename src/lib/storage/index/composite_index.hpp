@@ -0,0 +1,61 @@
+#pragma once
+
+#include <span>
+
+#include "adaptive_radix_tree_index.hpp"
+#include "base_index.hpp"
+
+namespace opossum {
+
+// CompositeIndex indexes several segments of a chunk, of any data types and encodings, together. Rows are ordered
+// lexicographically by their values, e.g., by (tenant_id, event_type, day). Thus, the rows matching equality
+// predicates on a prefix of the columns and a range predicate on the next column form one contiguous range:
+//
+//   tenant_id = 7 AND event_type = 'click' AND day >= 100 AND day < 200
+//     -> [lower_bound({7, "click", 100}), lower_bound({7, "click", 200}))
+//
+// Each row is represented by the concatenation of the ARTKeys of its values. ARTKeys are binary-comparable and no key
+// is a prefix of another, so comparing the concatenations bytewise compares the rows lexicographically. The distinct
+// keys are stored contiguously and searched with a binary search.
+// Rows with a NULL in any of the indexed columns are only listed by null_cbegin() and null_cend(), even for prefix
+// lookups that do not constrain the NULL column. Likewise, NaN is not ordered against any value, so rows with a NaN
+// (and no NULL) are only listed by nan_positions(), and both bounds of search values that contain NaN are cend(). The
+// segments must not be modified after the index was created.
+class CompositeIndex : public BaseIndex {
+ public:
+  // Creates an index over one or more segments of the same size.
+  explicit CompositeIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  size_t estimate_memory_usage() const final;
+
+  // Returns the chunk offsets of the rows with a NaN in any of the indexed columns, in ascending order.
+  const std::vector<ChunkOffset>& nan_positions() const;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+
+  // Returns the concatenated keys of the search values, which are converted to the types of the first columns.
+  ARTKey _encode_search_values(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns whether any of the search values is NaN.
+  bool _contains_nan(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns the nth distinct key.
+  std::span<const uint8_t> _key(const size_t key_index) const;
+
+  const std::vector<std::shared_ptr<const AbstractSegment>> _indexed_segments;
+  // Distinct keys in ascending order. Key i is stored in _keys[_key_begins[i], _key_begins[i + 1]).
+  std::vector<uint8_t> _keys;
+  std::vector<size_t> _key_begins;
+  // Chunk offsets of the rows without NULLs, ordered by their keys. The offsets of key i are stored in
+  // _chunk_offsets[_key_positions[i], _key_positions[i + 1]).
+  std::vector<ChunkOffset> _chunk_offsets;
+  std::vector<ChunkOffset> _key_positions;
+  std::vector<ChunkOffset> _nan_positions;
+};
+
+}  // namespace opossum
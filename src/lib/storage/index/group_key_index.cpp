@@ -0,0 +1,103 @@
+#include "group_key_index.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex{SegmentIndexType::GroupKey},
+      _indexed_segment{segments_to_index.size() == 1 ? segments_to_index.front() : nullptr} {
+  Assert(_indexed_segment, "GroupKeyIndex only works with a single segment.");
+  Assert(_indexed_segment->segment_type() == SegmentType::Dictionary,
+         "GroupKeyIndex only works with DictionarySegments.");
+
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto& segment = static_cast<const DictionarySegment<ColumnDataType>&>(*_indexed_segment);
+    const auto& attribute_vector = *segment.attribute_vector();
+    const auto null_value_id = segment.null_value_id();
+    // NaN rows are not indexed, like in the AdaptiveRadixTreeIndex. NaN has the last ValueID, if any.
+    const auto nan_value_id = segment.nan_value_id();
+
+    // Counting sort of the chunk offsets by ValueID: count the occurrences of each ValueID, turn the counts into start
+    // offsets, and place each chunk offset at the next free slot of its ValueID. Visiting the rows in order keeps the
+    // postings of each ValueID sorted.
+    const auto ordered_value_count = nan_value_id == INVALID_VALUE_ID ? segment.unique_values_count() : nan_value_id;
+    _value_start_offsets.assign(ordered_value_count + 1, 0);
+    auto null_count = size_t{0};
+    attribute_vector.for_each_block([&](const size_t, const std::span<const ValueID> value_ids) {
+      for (const auto value_id : value_ids) {
+        if (value_id == null_value_id) {
+          ++null_count;
+        } else if (value_id != nan_value_id) {
+          ++_value_start_offsets[value_id + 1];
+        }
+      }
+    });
+    for (auto value_id = size_t{1}; value_id < _value_start_offsets.size(); ++value_id) {
+      _value_start_offsets[value_id] += _value_start_offsets[value_id - 1];
+    }
+
+    _postings.resize(_value_start_offsets.back());
+    _null_positions.reserve(null_count);
+    auto next_offsets = std::vector<ChunkOffset>(_value_start_offsets.begin(), _value_start_offsets.end() - 1);
+    attribute_vector.for_each_block([&](const size_t first_index, const std::span<const ValueID> value_ids) {
+      const auto value_id_count = value_ids.size();
+      for (auto index = size_t{0}; index < value_id_count; ++index) {
+        const auto value_id = value_ids[index];
+        const auto chunk_offset = static_cast<ChunkOffset>(first_index + index);
+        if (value_id == null_value_id) {
+          _null_positions.push_back(chunk_offset);
+        } else if (value_id != nan_value_id) {
+          _postings[next_offsets[value_id]++] = chunk_offset;
+        }
+      }
+    });
+  });
+}
+
+size_t GroupKeyIndex::estimate_memory_usage() const {
+  return sizeof(ChunkOffset) * (_value_start_offsets.capacity() + _postings.capacity() + _null_positions.capacity());
+}
+
+BaseIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  auto value_id = INVALID_VALUE_ID;
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    value_id = static_cast<const DictionarySegment<ColumnDataType>&>(*_indexed_segment).lower_bound(values.front());
+  });
+  return _postings_begin(value_id);
+}
+
+BaseIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  auto value_id = INVALID_VALUE_ID;
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    value_id = static_cast<const DictionarySegment<ColumnDataType>&>(*_indexed_segment).upper_bound(values.front());
+  });
+  return _postings_begin(value_id);
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cbegin() const {
+  return _postings.cbegin();
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cend() const {
+  return _postings.cend();
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> GroupKeyIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+BaseIndex::Iterator GroupKeyIndex::_postings_begin(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) {
+    return _postings.cend();
+  }
+  return _postings.cbegin() + _value_start_offsets[value_id];
+}
+
+}  // namespace opossum
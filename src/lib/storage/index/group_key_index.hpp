@@ -0,0 +1,36 @@
+#pragma once
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+// GroupKeyIndex indexes a single DictionarySegment. It groups the chunk offsets by ValueID: _postings holds the
+// offsets of all non-NULL rows sorted by ValueID, and _value_start_offsets[value_id] is where the offsets of value_id
+// start. As ValueIDs are ordered like their values, the offsets of any value range are a contiguous range of
+// _postings, which the dictionary's lower_bound and upper_bound locate in O(log n). Scanning them costs O(result)
+// instead of O(chunk size). NaN is not ordered against any value: NaN rows are not indexed, and both bounds of a NaN
+// search value are cend().
+class GroupKeyIndex : public BaseIndex {
+ public:
+  // Creates an index over a single DictionarySegment.
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+
+  // Returns an iterator to the first posting of the given ValueID, or cend() for INVALID_VALUE_ID.
+  Iterator _postings_begin(const ValueID value_id) const;
+
+  const std::shared_ptr<const AbstractSegment> _indexed_segment;
+  // One entry per dictionary value plus one, so that the postings of value_id end at _value_start_offsets[value_id + 1]
+  std::vector<ChunkOffset> _value_start_offsets;
+  std::vector<ChunkOffset> _postings;
+};
+
+}  // namespace opossum
@@ -0,0 +1,213 @@
+#include "roaring_bitmap.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+RoaringBitmap::Container::Container(const uint16_t init_key) : key{init_key} {}
+
+bool RoaringBitmap::Container::is_bitmap() const {
+  return !words.empty();
+}
+
+void RoaringBitmap::Container::convert_to_bitmap() {
+  words.assign(BITMAP_WORD_COUNT, 0);
+  for (const auto low_bits : values) {
+    words[low_bits / 64] |= uint64_t{1} << (low_bits % 64);
+  }
+  values = std::vector<uint16_t>{};
+}
+
+void RoaringBitmap::Container::shrink() {
+  if (!is_bitmap() || cardinality > MAX_ARRAY_SIZE) {
+    return;
+  }
+  values.reserve(cardinality);
+  for (auto word_index = size_t{0}; word_index < BITMAP_WORD_COUNT; ++word_index) {
+    auto word = words[word_index];
+    while (word != 0) {
+      values.push_back(static_cast<uint16_t>(word_index * 64 + std::countr_zero(word)));
+      word &= word - 1;
+    }
+  }
+  words = std::vector<uint64_t>{};
+}
+
+void RoaringBitmap::add(const uint32_t value) {
+  const auto key = static_cast<uint16_t>(value >> 16);
+  const auto low_bits = static_cast<uint16_t>(value);
+  if (_containers.empty() || _containers.back().key != key) {
+    DebugAssert(_containers.empty() || _containers.back().key < key, "Values must be added in ascending order.");
+    _containers.push_back(Container{key});
+  }
+
+  auto& container = _containers.back();
+  if (container.is_bitmap()) {
+    container.words[low_bits / 64] |= uint64_t{1} << (low_bits % 64);
+  } else {
+    DebugAssert(container.values.empty() || container.values.back() < low_bits,
+                "Values must be added in ascending order.");
+    container.values.push_back(low_bits);
+    if (container.values.size() > MAX_ARRAY_SIZE) {
+      container.convert_to_bitmap();
+    }
+  }
+  ++container.cardinality;
+}
+
+void RoaringBitmap::shrink_to_fit() {
+  _containers.shrink_to_fit();
+  for (auto& container : _containers) {
+    container.values.shrink_to_fit();
+  }
+}
+
+bool RoaringBitmap::contains(const uint32_t value) const {
+  const auto key = static_cast<uint16_t>(value >> 16);
+  const auto low_bits = static_cast<uint16_t>(value);
+  const auto container = std::lower_bound(_containers.begin(), _containers.end(), key,
+                                          [](const auto& element, const auto search_key) {
+                                            return element.key < search_key;
+                                          });
+  if (container == _containers.end() || container->key != key) {
+    return false;
+  }
+  if (container->is_bitmap()) {
+    return (container->words[low_bits / 64] >> (low_bits % 64)) & 1;
+  }
+  return std::binary_search(container->values.begin(), container->values.end(), low_bits);
+}
+
+size_t RoaringBitmap::cardinality() const {
+  auto cardinality = size_t{0};
+  for (const auto& container : _containers) {
+    cardinality += container.cardinality;
+  }
+  return cardinality;
+}
+
+bool RoaringBitmap::empty() const {
+  return _containers.empty();
+}
+
+RoaringBitmap RoaringBitmap::operator&(const RoaringBitmap& other) const {
+  auto result = RoaringBitmap{};
+  auto left = _containers.begin();
+  auto right = other._containers.begin();
+  while (left != _containers.end() && right != other._containers.end()) {
+    if (left->key < right->key) {
+      ++left;
+    } else if (right->key < left->key) {
+      ++right;
+    } else {
+      auto container = _intersect(*left, *right);
+      if (container.cardinality > 0) {
+        result._containers.push_back(std::move(container));
+      }
+      ++left;
+      ++right;
+    }
+  }
+  return result;
+}
+
+RoaringBitmap RoaringBitmap::operator|(const RoaringBitmap& other) const {
+  auto result = *this;
+  result |= other;
+  return result;
+}
+
+RoaringBitmap& RoaringBitmap::operator|=(const RoaringBitmap& other) {
+  auto added_containers = std::vector<Container>{};
+  auto container = _containers.begin();
+  for (const auto& other_container : other._containers) {
+    while (container != _containers.end() && container->key < other_container.key) {
+      ++container;
+    }
+    if (container != _containers.end() && container->key == other_container.key) {
+      _unite_in_place(*container, other_container);
+    } else {
+      added_containers.push_back(other_container);
+    }
+  }
+
+  if (!added_containers.empty()) {
+    const auto old_container_count = static_cast<std::ptrdiff_t>(_containers.size());
+    _containers.insert(_containers.end(), std::make_move_iterator(added_containers.begin()),
+                       std::make_move_iterator(added_containers.end()));
+    std::inplace_merge(_containers.begin(), _containers.begin() + old_container_count, _containers.end(),
+                       [](const auto& left, const auto& right) { return left.key < right.key; });
+  }
+  return *this;
+}
+
+size_t RoaringBitmap::estimate_memory_usage() const {
+  auto memory_usage = sizeof(Container) * _containers.capacity();
+  for (const auto& container : _containers) {
+    memory_usage += sizeof(uint16_t) * container.values.capacity() + sizeof(uint64_t) * container.words.capacity();
+  }
+  return memory_usage;
+}
+
+RoaringBitmap::Container RoaringBitmap::_intersect(const Container& left, const Container& right) {
+  auto result = Container{left.key};
+  if (left.is_bitmap() && right.is_bitmap()) {
+    result.words.resize(BITMAP_WORD_COUNT);
+    for (auto word_index = size_t{0}; word_index < BITMAP_WORD_COUNT; ++word_index) {
+      result.words[word_index] = left.words[word_index] & right.words[word_index];
+      result.cardinality += std::popcount(result.words[word_index]);
+    }
+    result.shrink();
+  } else if (left.is_bitmap() || right.is_bitmap()) {
+    // Probe the bitmap with the values of the array.
+    const auto& array = left.is_bitmap() ? right : left;
+    const auto& bitmap = left.is_bitmap() ? left : right;
+    for (const auto low_bits : array.values) {
+      if ((bitmap.words[low_bits / 64] >> (low_bits % 64)) & 1) {
+        result.values.push_back(low_bits);
+      }
+    }
+    result.cardinality = static_cast<uint32_t>(result.values.size());
+  } else {
+    std::set_intersection(left.values.begin(), left.values.end(), right.values.begin(), right.values.end(),
+                          std::back_inserter(result.values));
+    result.cardinality = static_cast<uint32_t>(result.values.size());
+  }
+  return result;
+}
+
+void RoaringBitmap::_unite_in_place(Container& left, const Container& right) {
+  if (!left.is_bitmap() && !right.is_bitmap() && left.cardinality + right.cardinality <= MAX_ARRAY_SIZE) {
+    auto values = std::vector<uint16_t>{};
+    values.reserve(left.cardinality + right.cardinality);
+    std::set_union(left.values.begin(), left.values.end(), right.values.begin(), right.values.end(),
+                   std::back_inserter(values));
+    left.values = std::move(values);
+    left.cardinality = static_cast<uint32_t>(left.values.size());
+    return;
+  }
+
+  if (!left.is_bitmap()) {
+    left.convert_to_bitmap();
+  }
+  if (right.is_bitmap()) {
+    for (auto word_index = size_t{0}; word_index < BITMAP_WORD_COUNT; ++word_index) {
+      left.words[word_index] |= right.words[word_index];
+    }
+  } else {
+    for (const auto low_bits : right.values) {
+      left.words[low_bits / 64] |= uint64_t{1} << (low_bits % 64);
+    }
+  }
+  left.cardinality = 0;
+  for (const auto word : left.words) {
+    left.cardinality += std::popcount(word);
+  }
+  // Overlapping values can leave few enough values for an array.
+  left.shrink();
+}
+
+}  // namespace opossum
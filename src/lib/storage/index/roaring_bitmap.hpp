@@ -0,0 +1,95 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// RoaringBitmap is a compressed set of 32-bit values, e.g., the chunk offsets of the rows that match a predicate.
+// The values are partitioned by their upper 16 bits into containers. A container with few values stores their lower
+// 16 bits in a sorted array (two bytes per value), a dense container stores a bitmap of 2^16 bits (8 KiB). Thus, the
+// bitmap needs at most about two bytes per value and one bit per value for dense sets, and intersections and unions
+// work container by container without decompressing the whole set.
+class RoaringBitmap {
+ public:
+  RoaringBitmap() = default;
+
+  // Adds a value. Values must be added in strictly ascending order.
+  void add(const uint32_t value);
+
+  // Releases the memory that the arrays reserved for further values. Call it after the last add.
+  void shrink_to_fit();
+
+  // Returns whether the value is in the set.
+  bool contains(const uint32_t value) const;
+
+  // Returns the number of values.
+  size_t cardinality() const;
+
+  bool empty() const;
+
+  // Return the intersection and the union with another bitmap.
+  RoaringBitmap operator&(const RoaringBitmap& other) const;
+  RoaringBitmap operator|(const RoaringBitmap& other) const;
+
+  // Adds all values of another bitmap. Containers with keys in both bitmaps are united in place.
+  RoaringBitmap& operator|=(const RoaringBitmap& other);
+
+  // Calls functor(value) for all values in ascending order.
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    for (const auto& container : _containers) {
+      const auto high_bits = static_cast<uint32_t>(container.key) << 16;
+      if (container.is_bitmap()) {
+        for (auto word_index = size_t{0}; word_index < BITMAP_WORD_COUNT; ++word_index) {
+          auto word = container.words[word_index];
+          while (word != 0) {
+            functor(high_bits | static_cast<uint32_t>(word_index * 64 + std::countr_zero(word)));
+            word &= word - 1;
+          }
+        }
+      } else {
+        for (const auto low_bits : container.values) {
+          functor(high_bits | low_bits);
+        }
+      }
+    }
+  }
+
+  size_t estimate_memory_usage() const;
+
+  // Containers with more values than this are stored as bitmaps, since the array would be larger.
+  static constexpr auto MAX_ARRAY_SIZE = size_t{4096};
+
+ protected:
+  static constexpr auto BITMAP_WORD_COUNT = size_t{(1 << 16) / 64};
+
+  // Values that share the upper 16 bits. Either values (sorted lower 16 bits) or words (bitmap) is used.
+  struct Container {
+    explicit Container(const uint16_t init_key);
+
+    bool is_bitmap() const;
+
+    // Converts an array container to a bitmap container.
+    void convert_to_bitmap();
+
+    // Converts a bitmap container to an array container if the array is not larger.
+    void shrink();
+
+    uint16_t key;
+    uint32_t cardinality{0};
+    std::vector<uint16_t> values;
+    std::vector<uint64_t> words;
+  };
+
+  static Container _intersect(const Container& left, const Container& right);
+  static void _unite_in_place(Container& left, const Container& right);
+
+  // Containers ordered by key. Empty containers are not stored.
+  std::vector<Container> _containers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,95 @@
+#include "unique_hash_index.hpp"
+
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+bool AbstractUniqueHashIndex::contains(const AllTypeVariant& value) const {
+  return find(value).has_value();
+}
+
+template <typename T>
+std::optional<RowID> UniqueHashIndex<T>::find(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) {
+    return std::nullopt;
+  }
+  return find(type_cast<T>(value));
+}
+
+template <typename T>
+std::optional<RowID> UniqueHashIndex<T>::find(const T& value) const {
+  const auto iterator = _row_ids.find(value);
+  if (iterator == _row_ids.end()) {
+    return std::nullopt;
+  }
+  return iterator->second;
+}
+
+template <typename T>
+void UniqueHashIndex<T>::insert(const AllTypeVariant& value, const RowID row_id) {
+  Assert(!variant_is_null(value), "Unique indexes do not accept NULL values.");
+  const auto inserted = _row_ids.try_emplace(type_cast<T>(value), row_id).second;
+  Assert(inserted, "Value is already indexed.");
+}
+
+template <typename T>
+void UniqueHashIndex<T>::insert(const AbstractSegment& segment, const ChunkID chunk_id) {
+  Assert(segment.data_type() == data_type_of<T>, "Segment has a different data type than the index.");
+  _row_ids.reserve(_row_ids.size() + segment.size());
+
+  // Remember the inserted values to undo the insertion if a value is NULL or a duplicate.
+  auto inserted_values = std::vector<T>{};
+  inserted_values.reserve(segment.size());
+  auto valid = true;
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (!valid) {
+      return;
+    }
+    const auto row_id = RowID{chunk_id, position.chunk_offset()};
+    if (position.is_null() || !_row_ids.try_emplace(position.value(), row_id).second) {
+      valid = false;
+      return;
+    }
+    inserted_values.push_back(position.value());
+  });
+
+  if (!valid) {
+    for (const auto& value : inserted_values) {
+      _row_ids.erase(value);
+    }
+    Fail("Unique indexes do not accept NULL values or duplicates.");
+  }
+}
+
+template <typename T>
+void UniqueHashIndex<T>::erase(const AbstractSegment& segment, const ChunkID chunk_id) {
+  Assert(segment.data_type() == data_type_of<T>, "Segment has a different data type than the index.");
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) {
+      return;
+    }
+    // Only remove entries of this chunk, a duplicate value may be indexed for another row.
+    const auto iterator = _row_ids.find(position.value());
+    if (iterator != _row_ids.end() && iterator->second == RowID{chunk_id, position.chunk_offset()}) {
+      _row_ids.erase(iterator);
+    }
+  });
+}
+
+template <typename T>
+size_t UniqueHashIndex<T>::size() const {
+  return _row_ids.size();
+}
+
+template <typename T>
+size_t UniqueHashIndex<T>::estimate_memory_usage() const {
+  // Each entry is a node with a pointer to the next one. Each bucket holds a pointer.
+  return (sizeof(std::pair<const T, RowID>) + sizeof(void*)) * _row_ids.size() +
+         sizeof(void*) * _row_ids.bucket_count();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(UniqueHashIndex);
+
+}  // namespace opossum
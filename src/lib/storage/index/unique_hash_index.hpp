@@ -0,0 +1,70 @@
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+// A UniqueHashIndex maps each value of a column to the single row that holds it, e.g., for primary keys. Unlike the
+// chunk indexes (see BaseIndex), it spans all chunks of a table, so a point lookup is one hash probe regardless of the
+// table size. Tables maintain their unique indexes on every append (see Table::add_unique_index). Compressing a chunk
+// keeps the position of each row, so the RowIDs stay valid. NULLs and duplicates are rejected.
+class AbstractUniqueHashIndex : private Noncopyable {
+ public:
+  virtual ~AbstractUniqueHashIndex() = default;
+
+  // Returns the row that holds the value, or std::nullopt if there is none. NULL never matches.
+  virtual std::optional<RowID> find(const AllTypeVariant& value) const = 0;
+
+  // Returns whether a row holds the value.
+  bool contains(const AllTypeVariant& value) const;
+
+  // Adds a row. Fails if the value is NULL or already indexed.
+  virtual void insert(const AllTypeVariant& value, const RowID row_id) = 0;
+
+  // Adds all rows of a segment that belongs to the given chunk. If a value is NULL or already indexed, none of the
+  // rows are added.
+  virtual void insert(const AbstractSegment& segment, const ChunkID chunk_id) = 0;
+
+  // Removes the rows of a segment that were added with insert(segment, chunk_id), e.g., to undo the insertion when
+  // another index of the table rejects the chunk.
+  virtual void erase(const AbstractSegment& segment, const ChunkID chunk_id) = 0;
+
+  // Returns the number of indexed rows.
+  virtual size_t size() const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  AbstractUniqueHashIndex() = default;
+};
+
+template <typename T>
+class UniqueHashIndex : public AbstractUniqueHashIndex {
+ public:
+  UniqueHashIndex() = default;
+
+  std::optional<RowID> find(const AllTypeVariant& value) const final;
+  std::optional<RowID> find(const T& value) const;
+
+  void insert(const AllTypeVariant& value, const RowID row_id) final;
+  void insert(const AbstractSegment& segment, const ChunkID chunk_id) final;
+
+  void erase(const AbstractSegment& segment, const ChunkID chunk_id) final;
+
+  size_t size() const final;
+
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  std::unordered_map<T, RowID> _row_ids;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(UniqueHashIndex);
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#include "null_bitmap.hpp"
+
+#include <bit>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+NullBitmap::NullBitmap(const size_t size, const bool is_null)
+    : _words((size + WORD_BITS - 1) / WORD_BITS, is_null ? ~uint64_t{0} : uint64_t{0}),
+      _size{size},
+      _null_count{is_null ? size : 0} {
+  // Keep the bits beyond size() zero so that words can be counted and combined without masking.
+  if (is_null && size % WORD_BITS != 0) {
+    _words.back() = (uint64_t{1} << (size % WORD_BITS)) - 1;
+  }
+}
+
+void NullBitmap::push_back(const bool is_null) {
+  if (_size % WORD_BITS == 0) {
+    _words.push_back(0);
+  }
+  if (is_null) {
+    _words.back() |= uint64_t{1} << (_size % WORD_BITS);
+    ++_null_count;
+  }
+  ++_size;
+}
+
+void NullBitmap::set(const size_t index, const bool is_null) {
+  Assert(index < _size, "Row " + std::to_string(index) + " does not exist.");
+  const auto bit = uint64_t{1} << (index % WORD_BITS);
+  auto& word = _words[index / WORD_BITS];
+  if (static_cast<bool>(word & bit) == is_null) {
+    return;
+  }
+  if (is_null) {
+    word |= bit;
+    ++_null_count;
+  } else {
+    word &= ~bit;
+    --_null_count;
+  }
+}
+
+void NullBitmap::reserve(const size_t size) {
+  _words.reserve((size + WORD_BITS - 1) / WORD_BITS);
+}
+
+size_t NullBitmap::size() const {
+  return _size;
+}
+
+bool NullBitmap::empty() const {
+  return _size == 0;
+}
+
+size_t NullBitmap::null_count() const {
+  return _null_count;
+}
+
+size_t NullBitmap::null_count(const size_t begin, const size_t end) const {
+  Assert(begin <= end && end <= _size, "Invalid row range.");
+  if (begin == end) {
+    return 0;
+  }
+
+  const auto first_word = begin / WORD_BITS;
+  const auto last_word = (end - 1) / WORD_BITS;
+  const auto first_mask = ~uint64_t{0} << (begin % WORD_BITS);
+  const auto last_mask = ~uint64_t{0} >> (WORD_BITS - 1 - (end - 1) % WORD_BITS);
+  if (first_word == last_word) {
+    return std::popcount(_words[first_word] & first_mask & last_mask);
+  }
+
+  auto count = static_cast<size_t>(std::popcount(_words[first_word] & first_mask));
+  for (auto word_index = first_word + 1; word_index < last_word; ++word_index) {
+    count += std::popcount(_words[word_index]);
+  }
+  return count + std::popcount(_words[last_word] & last_mask);
+}
+
+bool NullBitmap::has_nulls() const {
+  return _null_count > 0;
+}
+
+const std::vector<uint64_t>& NullBitmap::words() const {
+  return _words;
+}
+
+size_t NullBitmap::estimate_memory_usage() const {
+  return _words.capacity() * sizeof(uint64_t);
+}
+
+}  // namespace opossum
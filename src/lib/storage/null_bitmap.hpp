@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace opossum {
+
+// NullBitmap stores one bit per row, set if the row is NULL. Unlike std::vector<bool>, the bits are exposed as 64-bit
+// words (the first row is the least significant bit of the first word), so operators can check 64 rows at once or
+// combine the words with their own bitmaps. The number of NULLs is tracked while appending, so has_nulls() is cheap
+// and operators can skip NULL handling for segments without any NULLs.
+class NullBitmap {
+ public:
+  NullBitmap() = default;
+
+  // Creates a bitmap of the given size with all bits set to is_null.
+  explicit NullBitmap(const size_t size, const bool is_null = false);
+
+  // Returns whether the row at the given index is NULL. Does not check bounds.
+  bool operator[](const size_t index) const {
+    return (_words[index / WORD_BITS] >> (index % WORD_BITS)) & uint64_t{1};
+  }
+
+  // Appends a row.
+  void push_back(const bool is_null);
+
+  // Marks the row at the given index as NULL or not NULL.
+  void set(const size_t index, const bool is_null);
+
+  // Reserves memory for the given number of rows.
+  void reserve(const size_t size);
+
+  // Returns the number of rows.
+  size_t size() const;
+
+  bool empty() const;
+
+  // Returns the number of NULLs.
+  size_t null_count() const;
+
+  // Returns the number of NULLs in the rows [begin, end), counted word by word.
+  size_t null_count(const size_t begin, const size_t end) const;
+
+  // Returns whether any row is NULL.
+  bool has_nulls() const;
+
+  // Returns the underlying words. Bits beyond size() are zero.
+  const std::vector<uint64_t>& words() const;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+  bool operator==(const NullBitmap& other) const = default;
+
+  static constexpr auto WORD_BITS = size_t{64};
+
+ protected:
+  std::vector<uint64_t> _words;
+  size_t _size{0};
+  size_t _null_count{0};
+};
+
+}  // namespace opossum
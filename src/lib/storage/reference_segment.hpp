@@ -17,6 +17,10 @@ class ReferenceSegment : public AbstractSegment {
 
   ChunkOffset size() const override;
 
+  DataType data_type() const final;
+
+  SegmentType segment_type() const final;
+
   const std::shared_ptr<const PosList>& pos_list() const;
 
   const std::shared_ptr<const Table>& referenced_table() const;
@@ -24,6 +28,11 @@ class ReferenceSegment : public AbstractSegment {
   ColumnID referenced_column_id() const;
 
   size_t estimate_memory_usage() const final;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
 };
 
 }  // namespace opossum
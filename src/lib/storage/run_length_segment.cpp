@@ -0,0 +1,119 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  _compress(abstract_segment);
+}
+
+template <typename T>
+void RunLengthSegment<T>::_compress(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+  const auto segment_size = abstract_segment->size();
+
+  // Extend the current run as long as the NULL flag and the value stay the same, otherwise start a new run.
+  for (auto index = ChunkOffset{0}; index < segment_size; ++index) {
+    const auto variant = abstract_segment->operator[](index);
+    const auto is_null = variant_is_null(variant);
+    const auto typed_value = is_null ? T{} : type_cast<T>(variant);
+
+    if (!_end_positions.empty() && _null_values.back() == is_null && (is_null || _values.back() == typed_value)) {
+      _end_positions.back() = index;
+      continue;
+    }
+
+    _values.push_back(typed_value);
+    _null_values.push_back(is_null);
+    _end_positions.push_back(index);
+  }
+
+  _values.shrink_to_fit();
+  _null_values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+AllTypeVariant RunLengthSegment<T>::operator[](const ChunkOffset chunk_offset) const {
+  const auto optional = get_typed_value(chunk_offset);
+  if (optional) {
+    return optional.value();
+  }
+  return NULL_VALUE;
+}
+
+template <typename T>
+T RunLengthSegment<T>::get(const ChunkOffset chunk_offset) const {
+  const auto optional = get_typed_value(chunk_offset);
+  Assert(optional, "Value at offset " + std::to_string(chunk_offset) + " is NULL.");
+  return optional.value();
+}
+
+template <typename T>
+std::optional<T> RunLengthSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  const auto run = run_index(chunk_offset);
+  if (_null_values[run]) {
+    return std::nullopt;
+  }
+  return _values[run];
+}
+
+template <typename T>
+const std::vector<T>& RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::vector<bool>& RunLengthSegment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_index(const ChunkOffset chunk_offset) const {
+  Assert(chunk_offset < size(), "Value at offset " + std::to_string(chunk_offset) + " does not exist.");
+  // The first run whose end position is not before the chunk offset contains the chunk offset.
+  const auto it = std::lower_bound(_end_positions.begin(), _end_positions.end(), chunk_offset);
+  return std::distance(_end_positions.begin(), it);
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _end_positions.size();
+}
+
+template <typename T>
+ChunkOffset RunLengthSegment<T>::size() const {
+  if (_end_positions.empty()) {
+    return 0;
+  }
+  return _end_positions.back() + 1;
+}
+
+template <typename T>
+DataType RunLengthSegment<T>::data_type() const {
+  return data_type_of<T>;
+}
+
+template <typename T>
+SegmentType RunLengthSegment<T>::segment_type() const {
+  return SegmentType::RunLength;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(T) * _values.capacity() + sizeof(ChunkOffset) * _end_positions.capacity() +
+         (_null_values.capacity() + 7) / 8;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
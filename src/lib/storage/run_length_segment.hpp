@@ -0,0 +1,61 @@
+#pragma once
+
+#include "abstract_segment.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is a specific segment type that stores runs of identical values only once. Each run is described by
+// its value, the chunk offset of its last row, and whether the run consists of NULL values. This is very compact for
+// sorted or clustered data and allows operators to evaluate a predicate once per run instead of once per row.
+template <typename T>
+class RunLengthSegment : public AbstractSegment {
+ public:
+  /**
+   * Creates a RunLength segment from a given value segment.
+   */
+  explicit RunLengthSegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+
+  // Returns the value at a certain position. If you want to write efficient operators, back off!
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
+
+  // Returns the value at a certain position. Throws an error if value is NULL.
+  T get(const ChunkOffset chunk_offset) const;
+
+  // Returns the value at a certain position. Returns std::nullopt if the value is NULL.
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  // Returns the value of each run. The value of a NULL run is unspecified.
+  const std::vector<T>& values() const;
+
+  // Returns one flag per run that is true if the run consists of NULL values.
+  const std::vector<bool>& null_values() const;
+
+  // Returns the chunk offset of the last row of each run. The offsets are strictly increasing.
+  const std::vector<ChunkOffset>& end_positions() const;
+
+  // Returns the index of the run containing the given chunk offset.
+  size_t run_index(const ChunkOffset chunk_offset) const;
+
+  // Returns the number of runs.
+  size_t run_count() const;
+
+  // Returns the number of entries.
+  ChunkOffset size() const override;
+
+  DataType data_type() const final;
+
+  SegmentType segment_type() const final;
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const final;
+
+ protected:
+  void _compress(const std::shared_ptr<AbstractSegment>& abstract_segment);
+  std::vector<T> _values;
+  std::vector<bool> _null_values;
+  std::vector<ChunkOffset> _end_positions;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
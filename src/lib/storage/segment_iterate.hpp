@@ -0,0 +1,413 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "abstract_attribute_vector.hpp"
+#include "alp_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "fsst_segment.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "table.hpp"
+#include "type_cast.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+/**
+ * Typed iteration over segments without going through AllTypeVariant. The concrete segment type is resolved once per
+ * segment (or, for ReferenceSegments, once per run of positions in the same referenced chunk) and the functor is then
+ * called with a SegmentPosition<T> for every row, e.g.:
+ *
+ *   segment_iterate<int32_t>(*segment, [&](const auto& position) {
+ *     if (!position.is_null() && position.value() > 5) {
+ *       matches.push_back(position.chunk_offset());
+ *     }
+ *   });
+ *
+ * The segment class is resolved with resolve_segment_type. Every segment class has a specialized path, e.g.,
+ * RunLengthSegments are iterated run by run, FrameOfReferenceSegments and ALPSegments block by block, and FSSTSegments
+ * decompress each value on its own. Only segments whose data type differs from T fall back to operator[], which is
+ * slow but correct.
+ */
+
+// A single row yielded by segment_iterate. The value of a NULL row is unspecified.
+template <typename T>
+class SegmentPosition {
+ public:
+  SegmentPosition(const T& value, const bool is_null, const ChunkOffset chunk_offset)
+      : _value{value}, _is_null{is_null}, _chunk_offset{chunk_offset} {}
+
+  const T& value() const {
+    return _value;
+  }
+
+  bool is_null() const {
+    return _is_null;
+  }
+
+  // Returns the position of the row in the segment or, for segment_iterate_filtered, in the position list.
+  ChunkOffset chunk_offset() const {
+    return _chunk_offset;
+  }
+
+ protected:
+  const T& _value;
+  const bool _is_null;
+  const ChunkOffset _chunk_offset;
+};
+
+namespace detail {
+
+// If at least every DICTIONARY_DECODE_RATIO-th row of a DictionarySegment is accessed by position, decoding the whole
+// attribute vector at once is cheaper than a virtual get() per position.
+constexpr auto DICTIONARY_DECODE_RATIO = size_t{8};
+
+// Likewise, segments that decode block by block only decode whole blocks if at least every BLOCK_DECODE_RATIO-th row is
+// accessed by position.
+constexpr auto BLOCK_DECODE_RATIO = size_t{8};
+
+template <typename T, typename Functor>
+void iterate_filtered(const AbstractSegment& segment, const std::span<const ChunkOffset> positions,
+                      const ChunkOffset first_offset, const Functor& functor);
+
+template <typename T, typename Functor>
+void iterate_value_segment(const ValueSegment<T>& segment, const Functor& functor) {
+  const auto& values = segment.values();
+  const auto size = segment.size();
+  if (!segment.has_null_values()) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      functor(SegmentPosition<T>{values[chunk_offset], false, chunk_offset});
+    }
+    return;
+  }
+
+  const auto& null_values = segment.null_values();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    functor(SegmentPosition<T>{values[chunk_offset], null_values[chunk_offset], chunk_offset});
+  }
+}
+
+template <typename T, typename Functor>
+void iterate_value_segment(const ValueSegment<T>& segment, const std::span<const ChunkOffset> positions,
+                           const ChunkOffset first_offset, const Functor& functor) {
+  const auto& values = segment.values();
+  const auto* null_values = segment.has_null_values() ? &segment.null_values() : nullptr;
+  for (auto index = size_t{0}; index < positions.size(); ++index) {
+    const auto position = positions[index];
+    const auto is_null = null_values && (*null_values)[position];
+    functor(SegmentPosition<T>{values[position], is_null, static_cast<ChunkOffset>(first_offset + index)});
+  }
+}
+
+// Calls functor with the dictionary values as a random-access container of T. StringDictionaries only hand out copies
+// of their front-coded entries, so they are decoded once up front.
+template <typename T, typename Functor>
+void with_dictionary_values(const DictionarySegment<T>& segment, const Functor& functor) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto& dictionary = segment.dictionary();
+    auto values = std::vector<std::string>{};
+    values.reserve(dictionary.size());
+    dictionary.for_each([&](const ValueID /*value_id*/, const std::string_view value) { values.emplace_back(value); });
+    functor(values);
+  } else {
+    functor(segment.dictionary());
+  }
+}
+
+template <typename T, typename Functor>
+void iterate_dictionary_segment(const DictionarySegment<T>& segment, const Functor& functor) {
+  with_dictionary_values(segment, [&](const auto& values) {
+    const auto null_value_id = segment.null_value_id();
+    const auto null_value = T{};
+    segment.attribute_vector()->for_each_block([&](const size_t first_index, const std::span<const ValueID> block) {
+      for (auto index = size_t{0}; index < block.size(); ++index) {
+        const auto value_id = block[index];
+        const auto is_null = value_id == null_value_id;
+        functor(SegmentPosition<T>{is_null ? null_value : values[value_id], is_null,
+                                   static_cast<ChunkOffset>(first_index + index)});
+      }
+    });
+  });
+}
+
+template <typename T, typename Functor>
+void iterate_dictionary_segment(const DictionarySegment<T>& segment, const std::span<const ChunkOffset> positions,
+                                const ChunkOffset first_offset, const Functor& functor) {
+  const auto null_value_id = segment.null_value_id();
+  const auto null_value = T{};
+  const auto& attribute_vector = *segment.attribute_vector();
+
+  // Decoding the dictionary and the attribute vector costs O(segment size). ReferenceSegments whose rows alternate
+  // between chunks pass short position lists many times, so only decode when the positions cover enough of the segment
+  // to pay for it. Otherwise, look up each value on its own.
+  if (positions.size() * DICTIONARY_DECODE_RATIO < attribute_vector.size()) {
+    const auto& dictionary = segment.dictionary();
+    for (auto index = size_t{0}; index < positions.size(); ++index) {
+      const auto value_id = attribute_vector.get(positions[index]);
+      const auto is_null = value_id == null_value_id;
+      // StringDictionaries return a copy of the entry, which the reference keeps alive.
+      const auto& value = is_null ? null_value : dictionary[value_id];
+      functor(SegmentPosition<T>{value, is_null, static_cast<ChunkOffset>(first_offset + index)});
+    }
+    return;
+  }
+
+  with_dictionary_values(segment, [&](const auto& values) {
+    auto value_ids = std::vector<ValueID>(attribute_vector.size());
+    attribute_vector.decode(0, value_ids.size(), value_ids.data());
+    for (auto index = size_t{0}; index < positions.size(); ++index) {
+      const auto value_id = value_ids[positions[index]];
+      const auto is_null = value_id == null_value_id;
+      functor(SegmentPosition<T>{is_null ? null_value : values[value_id], is_null,
+                                 static_cast<ChunkOffset>(first_offset + index)});
+    }
+  });
+}
+
+template <typename T, typename Functor>
+void iterate_run_length_segment(const RunLengthSegment<T>& segment, const Functor& functor) {
+  const auto& values = segment.values();
+  const auto& null_values = segment.null_values();
+  const auto& end_positions = segment.end_positions();
+  auto chunk_offset = ChunkOffset{0};
+  for (auto run_index = size_t{0}; run_index < end_positions.size(); ++run_index) {
+    const auto& value = values[run_index];
+    const auto is_null = null_values[run_index];
+    for (; chunk_offset <= end_positions[run_index]; ++chunk_offset) {
+      functor(SegmentPosition<T>{value, is_null, chunk_offset});
+    }
+  }
+}
+
+template <typename T, typename Functor>
+void iterate_run_length_segment(const RunLengthSegment<T>& segment, const std::span<const ChunkOffset> positions,
+                                const ChunkOffset first_offset, const Functor& functor) {
+  const auto& values = segment.values();
+  const auto& null_values = segment.null_values();
+  const auto& end_positions = segment.end_positions();
+  // Positions are mostly ascending. If a position is not in the run of the previous one or in the next run, the run is
+  // found by binary search.
+  auto run_index = size_t{0};
+  for (auto index = size_t{0}; index < positions.size(); ++index) {
+    const auto position = positions[index];
+    const auto run_begin = run_index == 0 ? ChunkOffset{0} : end_positions[run_index - 1] + 1;
+    if (position < run_begin || position > end_positions[run_index]) {
+      const auto is_in_next_run = position > end_positions[run_index] && run_index + 1 < end_positions.size() &&
+                                  position <= end_positions[run_index + 1];
+      run_index = is_in_next_run ? run_index + 1 : segment.run_index(position);
+    }
+    const auto is_null = null_values[run_index];
+    functor(SegmentPosition<T>{values[run_index], is_null, static_cast<ChunkOffset>(first_offset + index)});
+  }
+}
+
+// Iterates segments that decode block by block (FrameOfReferenceSegment, ALPSegment). Each block is decoded into a
+// buffer once.
+template <typename T, typename SegmentClass, typename Functor>
+void iterate_block_encoded_segment(const SegmentClass& segment, const Functor& functor) {
+  const auto& null_values = segment.null_values();
+  const auto size = segment.size();
+  auto block = std::vector<T>(SegmentClass::BLOCK_SIZE);
+  for (auto block_index = size_t{0}; block_index < segment.block_count(); ++block_index) {
+    segment.decode_block(block_index, block.data());
+    const auto first_chunk_offset = static_cast<ChunkOffset>(block_index * SegmentClass::BLOCK_SIZE);
+    const auto block_end = std::min(static_cast<ChunkOffset>(first_chunk_offset + SegmentClass::BLOCK_SIZE), size);
+    for (auto chunk_offset = first_chunk_offset; chunk_offset < block_end; ++chunk_offset) {
+      // null_values is empty if the segment has no NULLs.
+      const auto is_null = !null_values.empty() && null_values[chunk_offset];
+      functor(SegmentPosition<T>{block[chunk_offset - first_chunk_offset], is_null, chunk_offset});
+    }
+  }
+}
+
+template <typename T, typename SegmentClass, typename Functor>
+void iterate_block_encoded_segment(const SegmentClass& segment, const std::span<const ChunkOffset> positions,
+                                   const ChunkOffset first_offset, const Functor& functor) {
+  // Few positions are looked up one by one, like for DictionarySegments.
+  if (positions.size() * BLOCK_DECODE_RATIO < segment.size()) {
+    const auto null_value = T{};
+    for (auto index = size_t{0}; index < positions.size(); ++index) {
+      const auto value = segment.get_typed_value(positions[index]);
+      functor(SegmentPosition<T>{value ? *value : null_value, !value, static_cast<ChunkOffset>(first_offset + index)});
+    }
+    return;
+  }
+
+  // Otherwise, a block is decoded when the first position in it is accessed and kept as long as the following
+  // positions are in the same block.
+  const auto& null_values = segment.null_values();
+  auto block = std::vector<T>(SegmentClass::BLOCK_SIZE);
+  auto decoded_block_index = std::optional<size_t>{};
+  for (auto index = size_t{0}; index < positions.size(); ++index) {
+    const auto position = positions[index];
+    const auto block_index = size_t{position / SegmentClass::BLOCK_SIZE};
+    if (decoded_block_index != block_index) {
+      segment.decode_block(block_index, block.data());
+      decoded_block_index = block_index;
+    }
+    const auto is_null = !null_values.empty() && null_values[position];
+    functor(SegmentPosition<T>{block[position % SegmentClass::BLOCK_SIZE], is_null,
+                               static_cast<ChunkOffset>(first_offset + index)});
+  }
+}
+
+// FSSTSegments decompress each value on its own. The positions of the filtered variant may thus be in any order.
+template <typename Functor>
+void iterate_fsst_segment(const FSSTSegment<std::string>& segment, const std::span<const ChunkOffset> positions,
+                          const ChunkOffset first_offset, const Functor& functor) {
+  const auto null_value = std::string{};
+  for (auto index = size_t{0}; index < positions.size(); ++index) {
+    const auto value = segment.get_typed_value(positions[index]);
+    functor(SegmentPosition<std::string>{value ? *value : null_value, !value,
+                                         static_cast<ChunkOffset>(first_offset + index)});
+  }
+}
+
+template <typename Functor>
+void iterate_fsst_segment(const FSSTSegment<std::string>& segment, const Functor& functor) {
+  const auto null_value = std::string{};
+  const auto size = segment.size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+    const auto value = segment.get_typed_value(chunk_offset);
+    functor(SegmentPosition<std::string>{value ? *value : null_value, !value, chunk_offset});
+  }
+}
+
+// Iterates the rows referenced by row_id_at(0) to row_id_at(row_count - 1). Consecutive rows in the same chunk are
+// passed on to the referenced segment as a single position list.
+template <typename T, typename RowIDAt, typename Functor>
+void iterate_row_ids(const Table& table, const ColumnID column_id, const size_t row_count, const RowIDAt& row_id_at,
+                     const ChunkOffset first_offset, const Functor& functor) {
+  const auto null_value = T{};
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  auto index = size_t{0};
+  while (index < row_count) {
+    const auto row_id = row_id_at(index);
+    if (row_id.is_null()) {
+      functor(SegmentPosition<T>{null_value, true, static_cast<ChunkOffset>(first_offset + index)});
+      ++index;
+      continue;
+    }
+
+    const auto run_begin = index;
+    chunk_offsets.clear();
+    for (; index < row_count; ++index) {
+      const auto next_row_id = row_id_at(index);
+      if (next_row_id.is_null() || next_row_id.chunk_id != row_id.chunk_id) {
+        break;
+      }
+      chunk_offsets.push_back(next_row_id.chunk_offset);
+    }
+
+    const auto segment = table.get_chunk(row_id.chunk_id)->get_segment(column_id);
+    iterate_filtered<T>(*segment, chunk_offsets, static_cast<ChunkOffset>(first_offset + run_begin), functor);
+  }
+}
+
+template <typename T, typename Functor>
+void iterate_generic(const AbstractSegment& segment, const std::span<const ChunkOffset> positions,
+                     const ChunkOffset first_offset, const Functor& functor) {
+  for (auto index = size_t{0}; index < positions.size(); ++index) {
+    const auto variant = segment[positions[index]];
+    const auto is_null = variant_is_null(variant);
+    const auto value = is_null ? T{} : type_cast<T>(variant);
+    functor(SegmentPosition<T>{value, is_null, static_cast<ChunkOffset>(first_offset + index)});
+  }
+}
+
+template <typename T, typename Functor>
+void iterate_filtered(const AbstractSegment& segment, const std::span<const ChunkOffset> positions,
+                      const ChunkOffset first_offset, const Functor& functor) {
+  if (segment.segment_type() == SegmentType::Reference) {
+    const auto& reference_segment = static_cast<const ReferenceSegment&>(segment);
+    const auto& pos_list = *reference_segment.pos_list();
+    iterate_row_ids<T>(
+        *reference_segment.referenced_table(), reference_segment.referenced_column_id(), positions.size(),
+        [&](const size_t index) { return pos_list[positions[index]]; }, first_offset, functor);
+    return;
+  }
+  if (segment.data_type() != data_type_of<T>) {
+    iterate_generic<T>(segment, positions, first_offset, functor);
+    return;
+  }
+
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentClass = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentClass, ValueSegment<T>>) {
+      iterate_value_segment(typed_segment, positions, first_offset, functor);
+    } else if constexpr (std::is_same_v<SegmentClass, DictionarySegment<T>>) {
+      iterate_dictionary_segment(typed_segment, positions, first_offset, functor);
+    } else if constexpr (std::is_same_v<SegmentClass, RunLengthSegment<T>>) {
+      iterate_run_length_segment(typed_segment, positions, first_offset, functor);
+    } else if constexpr (std::is_same_v<SegmentClass, FrameOfReferenceSegment<T>> ||
+                         std::is_same_v<SegmentClass, ALPSegment<T>>) {
+      iterate_block_encoded_segment<T>(typed_segment, positions, first_offset, functor);
+    } else if constexpr (std::is_same_v<SegmentClass, FSSTSegment<T>>) {
+      iterate_fsst_segment(typed_segment, positions, first_offset, functor);
+    } else {
+      iterate_generic<T>(segment, positions, first_offset, functor);
+    }
+  });
+}
+
+}  // namespace detail
+
+// Calls functor(const SegmentPosition<T>&) for every row of the segment, in order.
+template <typename T, typename Functor>
+void segment_iterate(const AbstractSegment& segment, const Functor& functor) {
+  if (segment.segment_type() == SegmentType::Reference) {
+    const auto& reference_segment = static_cast<const ReferenceSegment&>(segment);
+    const auto& pos_list = *reference_segment.pos_list();
+    detail::iterate_row_ids<T>(
+        *reference_segment.referenced_table(), reference_segment.referenced_column_id(), pos_list.size(),
+        [&](const size_t index) { return pos_list[index]; }, ChunkOffset{0}, functor);
+    return;
+  }
+
+  const auto iterate_generic = [&]() {
+    auto positions = std::vector<ChunkOffset>(segment.size());
+    std::iota(positions.begin(), positions.end(), ChunkOffset{0});
+    detail::iterate_generic<T>(segment, positions, ChunkOffset{0}, functor);
+  };
+  if (segment.data_type() != data_type_of<T>) {
+    iterate_generic();
+    return;
+  }
+
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentClass = std::decay_t<decltype(typed_segment)>;
+    if constexpr (std::is_same_v<SegmentClass, ValueSegment<T>>) {
+      detail::iterate_value_segment(typed_segment, functor);
+    } else if constexpr (std::is_same_v<SegmentClass, DictionarySegment<T>>) {
+      detail::iterate_dictionary_segment(typed_segment, functor);
+    } else if constexpr (std::is_same_v<SegmentClass, RunLengthSegment<T>>) {
+      detail::iterate_run_length_segment(typed_segment, functor);
+    } else if constexpr (std::is_same_v<SegmentClass, FrameOfReferenceSegment<T>> ||
+                         std::is_same_v<SegmentClass, ALPSegment<T>>) {
+      detail::iterate_block_encoded_segment<T>(typed_segment, functor);
+    } else if constexpr (std::is_same_v<SegmentClass, FSSTSegment<T>>) {
+      detail::iterate_fsst_segment(typed_segment, functor);
+    } else {
+      iterate_generic();
+    }
+  });
+}
+
+// Calls functor(const SegmentPosition<T>&) for the rows at the given positions, in the order of the positions.
+// SegmentPosition::chunk_offset() is the index into positions, not the position itself.
+template <typename T, typename Functor>
+void segment_iterate_filtered(const AbstractSegment& segment, const std::span<const ChunkOffset> positions,
+                              const Functor& functor) {
+  detail::iterate_filtered<T>(segment, positions, ChunkOffset{0}, functor);
+}
+
+}  // namespace opossum
@@ -0,0 +1,122 @@
+#include "segment_statistics.hpp"
+
+#include <cmath>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+AbstractSegmentStatistics::AbstractSegmentStatistics(const ChunkOffset row_count, const size_t null_count,
+                                                     const std::optional<size_t> distinct_count)
+    : _row_count{row_count}, _null_count{null_count}, _distinct_count{distinct_count} {}
+
+ChunkOffset AbstractSegmentStatistics::row_count() const {
+  return _row_count;
+}
+
+size_t AbstractSegmentStatistics::null_count() const {
+  return _null_count;
+}
+
+std::optional<size_t> AbstractSegmentStatistics::distinct_count() const {
+  return _distinct_count;
+}
+
+template <typename T>
+SegmentStatistics<T>::SegmentStatistics(const ValueSegment<T>& segment, const std::optional<size_t> distinct_count,
+                                        const bool build_bloom_filter)
+    : AbstractSegmentStatistics{segment.size(), segment.has_null_values() ? segment.null_values().null_count() : 0,
+                                distinct_count} {
+  if (build_bloom_filter) {
+    // Duplicates set the same bits, so size the filter for the distinct values if we know their number.
+    _bloom_filter = std::make_unique<BloomFilter>(distinct_count.value_or(_row_count - _null_count));
+  }
+
+  const auto& values = segment.values();
+  const auto* null_values = segment.has_null_values() ? &segment.null_values() : nullptr;
+  const auto segment_size = segment.size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    if (null_values && (*null_values)[chunk_offset]) {
+      continue;
+    }
+
+    const auto& value = values[chunk_offset];
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(value)) {
+        _contains_nan = true;
+        continue;
+      }
+    }
+    if (_bloom_filter) {
+      _bloom_filter->insert(value_hash(value));
+    }
+    if (!_min || value < *_min) {
+      _min = value;
+    }
+    if (!_max || *_max < value) {
+      _max = value;
+    }
+  }
+}
+
+template <typename T>
+bool SegmentStatistics<T>::can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  // Comparisons with NULL never match.
+  if (variant_is_null(search_value)) {
+    return true;
+  }
+  return can_prune(scan_type, type_cast<T>(search_value));
+}
+
+template <typename T>
+bool SegmentStatistics<T>::can_prune(const ScanType scan_type, const T& search_value) const {
+  if (_contains_nan) {
+    return false;
+  }
+  // A segment holding only NULLs never matches.
+  if (!_min) {
+    return true;
+  }
+
+  const auto& min = *_min;
+  const auto& max = *_max;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      if (search_value < min || max < search_value) {
+        return true;
+      }
+      return _bloom_filter && !_bloom_filter->may_contain(value_hash(search_value));
+    case ScanType::OpNotEquals:
+      return min == search_value && max == search_value;
+    case ScanType::OpLessThan:
+      return !(min < search_value);
+    case ScanType::OpLessThanEquals:
+      return search_value < min;
+    case ScanType::OpGreaterThan:
+      return !(search_value < max);
+    case ScanType::OpGreaterThanEquals:
+      return max < search_value;
+  }
+  Fail("Unknown scan type.");
+}
+
+template <typename T>
+const std::optional<T>& SegmentStatistics<T>::min() const {
+  return _min;
+}
+
+template <typename T>
+const std::optional<T>& SegmentStatistics<T>::max() const {
+  return _max;
+}
+
+template <typename T>
+const std::unique_ptr<BloomFilter>& SegmentStatistics<T>::bloom_filter() const {
+  return _bloom_filter;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(SegmentStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "all_type_variant.hpp"
+#include "bloom_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ValueSegment;
+
+// AbstractSegmentStatistics summarize an immutable segment (a zone map). Table::compress_chunk computes them for
+// every segment and stores them in the Chunk, so that operators can skip segments without reading them.
+class AbstractSegmentStatistics : private Noncopyable {
+ public:
+  virtual ~AbstractSegmentStatistics() = default;
+
+  // Returns whether no row of the segment can satisfy "value <scan_type> search_value". If this returns false, rows
+  // may or may not match.
+  virtual bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // Returns the number of rows.
+  ChunkOffset row_count() const;
+
+  // Returns the number of NULLs.
+  size_t null_count() const;
+
+  // Returns the number of distinct non-NULL values, if it was cheap to determine (e.g., from a dictionary).
+  std::optional<size_t> distinct_count() const;
+
+ protected:
+  AbstractSegmentStatistics(const ChunkOffset row_count, const size_t null_count,
+                            const std::optional<size_t> distinct_count);
+
+  const ChunkOffset _row_count;
+  const size_t _null_count;
+  const std::optional<size_t> _distinct_count;
+};
+
+// Minimum and maximum of the non-NULL values of a segment with data type T and, optionally, a Bloom filter over them.
+// Min/max cannot prune equality predicates on high-cardinality columns (e.g., hashes or UUIDs), since nearly every
+// segment spans most of the domain. The Bloom filter can.
+template <typename T>
+class SegmentStatistics : public AbstractSegmentStatistics {
+ public:
+  // Computes the statistics of a ValueSegment in a single pass. The distinct count is not computed, but can be passed
+  // if the caller knows it.
+  explicit SegmentStatistics(const ValueSegment<T>& segment, const std::optional<size_t> distinct_count = std::nullopt,
+                             const bool build_bloom_filter = false);
+
+  bool can_prune(const ScanType scan_type, const AllTypeVariant& search_value) const final;
+
+  // Returns whether "value <scan_type> search_value" is false for all values in [min(), max()].
+  bool can_prune(const ScanType scan_type, const T& search_value) const;
+
+  // Return the smallest and largest non-NULL value, or std::nullopt if all values are NULL.
+  const std::optional<T>& min() const;
+  const std::optional<T>& max() const;
+
+  // Returns the Bloom filter over the non-NULL values, or nullptr if none was built.
+  const std::unique_ptr<BloomFilter>& bloom_filter() const;
+
+ protected:
+  std::optional<T> _min;
+  std::optional<T> _max;
+  // NaN is neither smaller nor larger than any value, so segments containing NaN are never pruned.
+  bool _contains_nan{false};
+  std::unique_ptr<BloomFilter> _bloom_filter;
+};
+
+EXPLICITLY_DECLARE_DATA_TYPES(SegmentStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,198 @@
+#include "string_dictionary.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Lengths are stored as LEB128 varints, so short strings (the common case) only need a single length byte.
+size_t varint_size(size_t value) {
+  auto byte_count = size_t{1};
+  while (value >= 0x80) {
+    value >>= 7;
+    ++byte_count;
+  }
+  return byte_count;
+}
+
+void append_varint(std::vector<char>& data, size_t value) {
+  while (value >= 0x80) {
+    data.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  data.push_back(static_cast<char>(value));
+}
+
+size_t read_varint(const std::vector<char>& data, size_t& offset) {
+  auto value = size_t{0};
+  auto shift = size_t{0};
+  while (true) {
+    const auto byte = static_cast<uint8_t>(data[offset++]);
+    value |= static_cast<size_t>(byte & 0x7F) << shift;
+    if (byte < 0x80) {
+      return value;
+    }
+    shift += 7;
+  }
+}
+
+size_t shared_prefix_length(const std::string& previous, const std::string& current) {
+  const auto max_length = std::min(previous.size(), current.size());
+  return std::mismatch(previous.begin(), previous.begin() + max_length, current.begin()).first - previous.begin();
+}
+
+}  // namespace
+
+StringDictionary::StringDictionary(const std::vector<std::string>& sorted_values)
+    : StringDictionary(sorted_values, estimate_memory_usage(sorted_values, FRONT_CODED_BLOCK_SIZE) <
+                                              estimate_memory_usage(sorted_values, 1)
+                                          ? FRONT_CODED_BLOCK_SIZE
+                                          : 1) {}
+
+StringDictionary::StringDictionary(const std::vector<std::string>& sorted_values, const uint32_t block_size)
+    : _size{sorted_values.size()}, _block_size{block_size} {
+  Assert(block_size >= 1, "Block size must be at least 1.");
+  DebugAssert(std::adjacent_find(sorted_values.begin(), sorted_values.end(), std::greater_equal<>{}) ==
+                  sorted_values.end(),
+              "Dictionary values must be sorted and unique.");
+
+  _restart_offsets.reserve((_size + block_size - 1) / block_size);
+  for (auto index = size_t{0}; index < _size; ++index) {
+    const auto& value = sorted_values[index];
+    if (index % block_size == 0) {
+      Assert(_data.size() <= std::numeric_limits<uint32_t>::max(), "String dictionary exceeds 4 GB.");
+      _restart_offsets.push_back(static_cast<uint32_t>(_data.size()));
+      append_varint(_data, value.size());
+      _data.insert(_data.end(), value.begin(), value.end());
+      continue;
+    }
+
+    const auto shared = shared_prefix_length(sorted_values[index - 1], value);
+    append_varint(_data, shared);
+    append_varint(_data, value.size() - shared);
+    _data.insert(_data.end(), value.begin() + static_cast<std::ptrdiff_t>(shared), value.end());
+  }
+  _data.shrink_to_fit();
+}
+
+std::string StringDictionary::operator[](const size_t index) const {
+  DebugAssert(index < _size, "Index " + std::to_string(index) + " is out of range.");
+  const auto block_index = index / _block_size;
+  auto value = std::string{_restart_value(block_index)};
+  if (_block_size == 1) {
+    return value;
+  }
+
+  // Skip the restart entry and apply the deltas of the following entries up to the requested one.
+  auto offset = size_t{_restart_offsets[block_index]};
+  offset += varint_size(value.size()) + value.size();
+  for (auto entry_index = block_index * _block_size + 1; entry_index <= index; ++entry_index) {
+    offset = _decode_entry(offset, false, value);
+  }
+  return value;
+}
+
+size_t StringDictionary::size() const {
+  return _size;
+}
+
+uint32_t StringDictionary::block_size() const {
+  return _block_size;
+}
+
+ValueID StringDictionary::lower_bound(const std::string_view value) const {
+  // Find the first block whose restart value is >= the search value. The result is either in the preceding block or
+  // the restart point of that block.
+  const auto block_count = _restart_offsets.size();
+  auto low = size_t{0};
+  auto high = block_count;
+  while (low < high) {
+    const auto middle = low + (high - low) / 2;
+    if (_restart_value(middle) < value) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  if (low == 0) {
+    return ValueID{0};
+  }
+  return _find_in_block(low - 1, [&](const std::string_view entry) { return entry >= value; });
+}
+
+ValueID StringDictionary::upper_bound(const std::string_view value) const {
+  const auto block_count = _restart_offsets.size();
+  auto low = size_t{0};
+  auto high = block_count;
+  while (low < high) {
+    const auto middle = low + (high - low) / 2;
+    if (_restart_value(middle) <= value) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+
+  if (low == 0) {
+    return ValueID{0};
+  }
+  return _find_in_block(low - 1, [&](const std::string_view entry) { return entry > value; });
+}
+
+size_t StringDictionary::estimate_memory_usage() const {
+  return _data.capacity() + sizeof(uint32_t) * _restart_offsets.capacity();
+}
+
+size_t StringDictionary::estimate_memory_usage(const std::vector<std::string>& sorted_values,
+                                               const uint32_t block_size) {
+  const auto value_count = sorted_values.size();
+  auto data_size = size_t{0};
+  for (auto index = size_t{0}; index < value_count; ++index) {
+    const auto& value = sorted_values[index];
+    if (index % block_size == 0) {
+      data_size += varint_size(value.size()) + value.size();
+      continue;
+    }
+    const auto shared = shared_prefix_length(sorted_values[index - 1], value);
+    data_size += varint_size(shared) + varint_size(value.size() - shared) + value.size() - shared;
+  }
+  return data_size + sizeof(uint32_t) * ((value_count + block_size - 1) / block_size);
+}
+
+std::string_view StringDictionary::_restart_value(const size_t block_index) const {
+  auto offset = size_t{_restart_offsets[block_index]};
+  const auto length = read_varint(_data, offset);
+  return {_data.data() + offset, length};
+}
+
+size_t StringDictionary::_decode_entry(size_t offset, const bool is_restart, std::string& value) const {
+  const auto shared = is_restart ? size_t{0} : read_varint(_data, offset);
+  const auto suffix_length = read_varint(_data, offset);
+  value.resize(shared);
+  value.append(_data.data() + offset, suffix_length);
+  return offset + suffix_length;
+}
+
+template <typename Predicate>
+ValueID StringDictionary::_find_in_block(const size_t block_index, const Predicate& predicate) const {
+  const auto block_begin = block_index * _block_size;
+  const auto block_end = std::min(block_begin + _block_size, _size);
+
+  // The restart value is known to fail the predicate, so only the remaining entries of the block are decoded.
+  auto value = std::string{_restart_value(block_index)};
+  auto offset = size_t{_restart_offsets[block_index]} + varint_size(value.size()) + value.size();
+  for (auto index = block_begin + 1; index < block_end; ++index) {
+    offset = _decode_entry(offset, false, value);
+    if (predicate(value)) {
+      return ValueID{static_cast<ValueID::base_type>(index)};
+    }
+  }
+  return ValueID{static_cast<ValueID::base_type>(block_end)};
+}
+
+}  // namespace opossum
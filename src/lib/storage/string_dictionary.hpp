@@ -0,0 +1,85 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// StringDictionary stores the sorted, unique strings of a dictionary-encoded segment in a single contiguous character
+// buffer instead of one heap-allocated std::string per entry. Entries are grouped into blocks. The first entry of a
+// block (the restart point) is stored in full, every following entry only stores the length of the prefix it shares
+// with its predecessor and the remaining suffix (front coding). The offsets of the restart points are kept in a
+// separate array, so binary searches only compare full, uncompressed strings and then scan a single block.
+//
+// Entry layout: restart entry = varint(length) + bytes, other entries = varint(shared) + varint(suffix length) + bytes.
+// A block size of 1 disables front coding, i.e., every entry is a restart point.
+class StringDictionary {
+ public:
+  // Number of entries per block when front coding is used.
+  static constexpr auto FRONT_CODED_BLOCK_SIZE = uint32_t{16};
+
+  StringDictionary() = default;
+
+  // Encodes the given sorted and unique values. Uses front coding if it needs less memory than the plain layout.
+  explicit StringDictionary(const std::vector<std::string>& sorted_values);
+
+  // Encodes the given sorted and unique values with the given number of entries per block.
+  StringDictionary(const std::vector<std::string>& sorted_values, const uint32_t block_size);
+
+  // Returns the value at the given index (i.e., ValueID). Decodes at most one block.
+  std::string operator[](const size_t index) const;
+
+  // Returns the number of entries.
+  size_t size() const;
+
+  // Returns the number of entries per block.
+  uint32_t block_size() const;
+
+  // Returns the first ValueID that refers to a value >= the search value, or size() if there is none.
+  ValueID lower_bound(const std::string_view value) const;
+
+  // Returns the first ValueID that refers to a value > the search value, or size() if there is none.
+  ValueID upper_bound(const std::string_view value) const;
+
+  // Calls functor(ValueID, std::string_view) for every entry in sorted order. This is much faster than calling
+  // operator[] for every ValueID, since each entry is decoded only once. The string_view is only valid during the call.
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    // Blocks are stored back to back, so all entries can be decoded in a single pass over the buffer.
+    auto value = std::string{};
+    auto offset = size_t{0};
+    for (auto value_id = ValueID{0}; value_id < _size; ++value_id) {
+      offset = _decode_entry(offset, value_id % _block_size == 0, value);
+      functor(value_id, std::string_view{value});
+    }
+  }
+
+  // Returns the calculated memory usage.
+  size_t estimate_memory_usage() const;
+
+  // Returns the memory a StringDictionary with the given values and block size would occupy.
+  static size_t estimate_memory_usage(const std::vector<std::string>& sorted_values, const uint32_t block_size);
+
+ protected:
+  // Returns the full string stored at a restart point without copying it.
+  std::string_view _restart_value(const size_t block_index) const;
+
+  // Decodes the entry at the given byte offset into value, which must hold the preceding entry unless the entry is a
+  // restart point. Returns the byte offset of the next entry.
+  size_t _decode_entry(size_t offset, const bool is_restart, std::string& value) const;
+
+  // Decodes the entries of the block until the predicate holds and returns its ValueID, or the first ValueID of the
+  // next block if it holds for none of them.
+  template <typename Predicate>
+  ValueID _find_in_block(const size_t block_index, const Predicate& predicate) const;
+
+  std::vector<char> _data;
+  std::vector<uint32_t> _restart_offsets;
+  size_t _size{0};
+  uint32_t _block_size{1};
+};
+
+}  // namespace opossum
@@ -1,30 +1,115 @@
 #include "table.hpp"
 
-#include <future>
-#include <thread>
+#include "alp_segment.hpp"
+#include "column_statistics.hpp"
 #include "dictionary_segment.hpp"
+#include "encoding_advisor.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "fsst_segment.hpp"
+#include "index/bitmap_index.hpp"
+#include "index/unique_hash_index.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_group.hpp"
+#include "run_length_segment.hpp"
+#include "segment_statistics.hpp"
+#include "table_statistics.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
 namespace opossum {
 
+namespace {
+
+struct EncodedSegment {
+  std::shared_ptr<AbstractSegment> segment;
+  EncodingDecision decision;
+  std::shared_ptr<const AbstractSegmentStatistics> statistics;
+  std::shared_ptr<const AbstractColumnStatistics> column_statistics;
+};
+
+// Encodes a ValueSegment with the requested encoding or, if none is requested, with the encoding recommended by the
+// EncodingAdvisor. Requested encodings that are not defined for T fall back to dictionary encoding. Also computes the
+// segment and column statistics of the segment.
+template <typename T>
+EncodedSegment encode_segment(const std::shared_ptr<ValueSegment<T>>& segment,
+                              const std::optional<EncodingType> requested_encoding_type,
+                              const bool build_bloom_filter) {
+  auto encoding_type = EncodingType::Dictionary;
+  if (!requested_encoding_type) {
+    encoding_type = EncodingAdvisor<T>{*segment}.recommended_encoding();
+  } else if (is_encoding_supported<T>(*requested_encoding_type)) {
+    encoding_type = *requested_encoding_type;
+  }
+
+  auto encoded_segment = std::shared_ptr<AbstractSegment>{};
+  switch (encoding_type) {
+    case EncodingType::Dictionary:
+      encoded_segment = std::make_shared<DictionarySegment<T>>(segment);
+      break;
+    case EncodingType::RunLength:
+      encoded_segment = std::make_shared<RunLengthSegment<T>>(segment);
+      break;
+    case EncodingType::FrameOfReference:
+      if constexpr (is_encoding_supported<T>(EncodingType::FrameOfReference)) {
+        encoded_segment = std::make_shared<FrameOfReferenceSegment<T>>(segment);
+      }
+      break;
+    case EncodingType::FSST:
+      if constexpr (is_encoding_supported<T>(EncodingType::FSST)) {
+        encoded_segment = std::make_shared<FSSTSegment<T>>(segment);
+      }
+      break;
+    case EncodingType::ALP:
+      if constexpr (is_encoding_supported<T>(EncodingType::ALP)) {
+        encoded_segment = std::make_shared<ALPSegment<T>>(segment);
+      }
+      break;
+  }
+  Assert(encoded_segment, "Unknown encoding type.");
+
+  const auto decision = EncodingDecision{encoding_type, requested_encoding_type.has_value(),
+                                         segment->estimate_memory_usage(), encoded_segment->estimate_memory_usage()};
+
+  // The distinct count comes for free with dictionary encoding.
+  auto distinct_count = std::optional<size_t>{};
+  if (encoding_type == EncodingType::Dictionary) {
+    distinct_count = std::static_pointer_cast<DictionarySegment<T>>(encoded_segment)->unique_values_count();
+  }
+  const auto statistics = std::make_shared<SegmentStatistics<T>>(*segment, distinct_count, build_bloom_filter);
+  const auto column_statistics = std::make_shared<ColumnStatistics<T>>(*segment);
+  return {encoded_segment, decision, statistics, column_statistics};
+}
+
+}  // namespace
+
 Table::Table(const ChunkOffset target_chunk_size) : _max_chunk_size{target_chunk_size} {
   create_new_chunk();
 }
 
 void Table::add_column_definition(const std::string& name, const std::string& type, const bool nullable) {
+  add_column_definition(name, data_type_from_string(type), nullable);
+}
+
+void Table::add_column_definition(const std::string& name, const DataType data_type, const bool nullable) {
   Assert(row_count() == 0, "Table already has values.");
   Assert(std::find(_column_names.begin(), _column_names.end(), name) == _column_names.end(),
          "Cannot add column with name '" + name + "' already present in table.");
   _column_names.push_back(name);
-  _column_types.push_back(type);
+  _column_types.push_back(data_type);
   _column_nullable.push_back(nullable);
+  _column_encodings.emplace_back(std::nullopt);
+  _column_bloom_filters.push_back(false);
+  _column_bitmap_indexes.push_back(false);
+  _unique_indexes.emplace_back();
 }
 
 void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
-  add_column_definition(name, type, nullable);
-  resolve_data_type(type, [&nullable, this](const auto data_type_t) {
+  add_column(name, data_type_from_string(type), nullable);
+}
+
+void Table::add_column(const std::string& name, const DataType data_type, const bool nullable) {
+  add_column_definition(name, data_type, nullable);
+  resolve_data_type(data_type, [&nullable, this](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
     const auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(nullable);
     // We only have one chunk since there are no values in the table.
@@ -47,12 +132,59 @@ void Table::create_new_chunk() {
   _chunks.push_back(chunk);
 }
 
+void Table::emplace_chunk(const std::shared_ptr<Chunk>& chunk) {
+  Assert(chunk->column_count() == column_count(), "Chunk has a different number of columns.");
+  // Replace the initial empty chunk.
+  const auto replaces_initial_chunk = _chunks.size() == 1 && _chunks.front()->size() == 0;
+  const auto chunk_id = replaces_initial_chunk ? ChunkID{0} : chunk_count();
+
+  // Each index rejects the chunk without keeping any of its rows. Undo the indexes that accepted it before, so that a
+  // rejected chunk leaves the table unchanged.
+  for (auto column_id = ColumnID{0}; column_id < _unique_indexes.size(); ++column_id) {
+    if (!_unique_indexes[column_id]) {
+      continue;
+    }
+    try {
+      _unique_indexes[column_id]->insert(*chunk->get_segment(column_id), chunk_id);
+    } catch (const std::logic_error&) {
+      for (auto indexed_column_id = ColumnID{0}; indexed_column_id < column_id; ++indexed_column_id) {
+        if (_unique_indexes[indexed_column_id]) {
+          _unique_indexes[indexed_column_id]->erase(*chunk->get_segment(indexed_column_id), chunk_id);
+        }
+      }
+      throw;
+    }
+  }
+
+  if (replaces_initial_chunk) {
+    _chunks.front() = chunk;
+    return;
+  }
+  _chunks.push_back(chunk);
+}
+
 void Table::append(const std::vector<AllTypeVariant>& values) {
+  // Check the unique indexes before modifying anything, so that a violating row leaves the table unchanged.
+  for (auto column_id = ColumnID{0}; column_id < _unique_indexes.size(); ++column_id) {
+    if (_unique_indexes[column_id]) {
+      Assert(column_id < values.size() && !variant_is_null(values[column_id]) &&
+                 !_unique_indexes[column_id]->contains(values[column_id]),
+             "Column '" + _column_names[column_id] + "' has a unique index and does not accept NULLs or duplicates.");
+    }
+  }
+
   if (_chunks.back()->size() >= _max_chunk_size) {
     create_new_chunk();
   }
   const auto& chunk = _chunks.back();
   chunk->append(values);
+
+  const auto row_id = RowID{ChunkID(_chunks.size() - 1), chunk->size() - 1};
+  for (auto column_id = ColumnID{0}; column_id < _unique_indexes.size(); ++column_id) {
+    if (_unique_indexes[column_id]) {
+      _unique_indexes[column_id]->insert(values[column_id], row_id);
+    }
+  }
 }
 
 ColumnCount Table::column_count() const {
@@ -91,6 +223,10 @@ const std::string& Table::column_name(const ColumnID column_id) const {
 }
 
 const std::string& Table::column_type(const ColumnID column_id) const {
+  return data_type_to_string(column_data_type(column_id));
+}
+
+DataType Table::column_data_type(const ColumnID column_id) const {
   Assert(column_id < _column_types.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
   return _column_types[column_id];
 }
@@ -110,25 +246,75 @@ std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   return _chunks[chunk_id];
 }
 
-void Table::compress_chunk(const ChunkID chunk_id) {
-  // Typedef to limit word vomit
-  using abstract_ptr = std::shared_ptr<AbstractSegment>;
+void Table::set_column_encoding(const ColumnID column_id, const std::optional<EncodingType> encoding_type) {
+  Assert(column_id < _column_encodings.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  _column_encodings[column_id] = encoding_type;
+}
 
-  const auto compress_segment = [](const abstract_ptr& segment) -> abstract_ptr {
-#define TRY_COMPRESS_TYPE(Type, Segment)                        \
-  if (std::dynamic_pointer_cast<ValueSegment<Type>>(Segment)) { \
-    return std::make_shared<DictionarySegment<Type>>(Segment);  \
-  }
-    // Explicitly try to convert for each data type using macros for better readability
-    TRY_COMPRESS_TYPE(int32_t, segment);
-    TRY_COMPRESS_TYPE(int64_t, segment);
-    TRY_COMPRESS_TYPE(std::string, segment);
-    TRY_COMPRESS_TYPE(float, segment);
-    TRY_COMPRESS_TYPE(double, segment);
+std::optional<EncodingType> Table::column_encoding(const ColumnID column_id) const {
+  Assert(column_id < _column_encodings.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  return _column_encodings[column_id];
+}
+
+void Table::set_column_bloom_filter(const ColumnID column_id, const bool enabled) {
+  Assert(column_id < _column_bloom_filters.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  _column_bloom_filters[column_id] = enabled;
+}
+
+bool Table::column_bloom_filter(const ColumnID column_id) const {
+  Assert(column_id < _column_bloom_filters.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  return _column_bloom_filters[column_id];
+}
+
+void Table::add_unique_index(const ColumnID column_id) {
+  Assert(column_id < _unique_indexes.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  Assert(!_unique_indexes[column_id], "Column with ID " + std::to_string(column_id) + " already has a unique index.");
+  resolve_data_type(_column_types[column_id], [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    // Build the index completely before attaching it, so that a column with NULLs or duplicates keeps no index.
+    const auto index = std::make_shared<UniqueHashIndex<ColumnDataType>>();
+    for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+      index->insert(*_chunks[chunk_id]->get_segment(column_id), chunk_id);
+    }
+    _unique_indexes[column_id] = index;
+  });
+}
+
+std::shared_ptr<const AbstractUniqueHashIndex> Table::unique_index(const ColumnID column_id) const {
+  Assert(column_id < _unique_indexes.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  return _unique_indexes[column_id];
+}
 
-#undef TRY_COMPRESS_TYPE
+void Table::set_column_bitmap_index(const ColumnID column_id, const bool enabled) {
+  Assert(column_id < _column_bitmap_indexes.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  _column_bitmap_indexes[column_id] = enabled;
+}
+
+bool Table::column_bitmap_index(const ColumnID column_id) const {
+  Assert(column_id < _column_bitmap_indexes.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  return _column_bitmap_indexes[column_id];
+}
+
+std::shared_ptr<const TableStatistics> Table::table_statistics() const {
+  return _table_statistics;
+}
+
+std::vector<EncodingDecision> Table::compress_chunk(const ChunkID chunk_id,
+                                                    const std::optional<EncodingType> encoding_type) {
+  // Typedef to limit word vomit
+  using abstract_ptr = std::shared_ptr<AbstractSegment>;
+  using encoded_segment = EncodedSegment;
 
-    Fail("Invalid type for compression.");
+  const auto compress_segment = [](const abstract_ptr& segment, const std::optional<EncodingType> segment_encoding_type,
+                                   const bool build_bloom_filter) -> encoded_segment {
+    Assert(segment->segment_type() == SegmentType::Value, "Only ValueSegments can be compressed.");
+    auto result = encoded_segment{};
+    resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      result = encode_segment<ColumnDataType>(std::static_pointer_cast<ValueSegment<ColumnDataType>>(segment),
+                                              segment_encoding_type, build_bloom_filter);
+    });
+    return result;
   };
 
   const auto current_chunk_count = chunk_count();
@@ -144,31 +330,58 @@ void Table::compress_chunk(const ChunkID chunk_id) {
   // Keep currently compressing chunk for reading.
   const auto chunk = get_chunk(chunk_id);
   const auto segment_count = chunk->column_count();
-  auto futures = std::vector<std::future<abstract_ptr>>{};
-  futures.reserve(segment_count);
+  auto encoded_segments = std::vector<encoded_segment>(segment_count);
 
+  // Segments are compressed independently of each other, so schedule one job per column. The scheduler bounds the
+  // number of threads, no matter how wide the table is.
+  auto jobs = JobGroup{};
   for (auto index = ColumnID{0}; index < segment_count; ++index) {
     const auto segment = chunk->get_segment(index);
-    auto task = std::packaged_task<abstract_ptr(abstract_ptr)>(compress_segment);
-    auto future = task.get_future();
-    auto thread = std::thread(std::move(task), segment);
-
-    // Allow execution to continue in the background.
-    futures.push_back(std::move(future));
-    thread.detach();
+    // An encoding passed by the caller takes precedence over the column's override. Without either, the
+    // EncodingAdvisor chooses.
+    const auto segment_encoding_type = encoding_type ? encoding_type : _column_encodings[index];
+    const bool build_bloom_filter = _column_bloom_filters[index];
+    jobs.schedule([&, index, segment, segment_encoding_type, build_bloom_filter] {
+      encoded_segments[index] = compress_segment(segment, segment_encoding_type, build_bloom_filter);
+    });
   }
+  jobs.wait();
 
   // Create new empty chunk and append segments to it.
   auto compressed_chunk = std::make_shared<Chunk>();
-  for (auto& future : futures) {
-    future.wait();
-    const auto compressed_segment = future.get();
+  auto decisions = std::vector<EncodingDecision>{};
+  decisions.reserve(segment_count);
+  auto segment_statistics = std::vector<std::shared_ptr<const AbstractSegmentStatistics>>{};
+  segment_statistics.reserve(segment_count);
+  auto column_statistics = std::vector<std::shared_ptr<const AbstractColumnStatistics>>{};
+  column_statistics.reserve(segment_count);
+  for (auto& [compressed_segment, decision, statistics, chunk_column_statistics] : encoded_segments) {
     compressed_chunk->add_segment(compressed_segment);
+    decisions.push_back(decision);
+    segment_statistics.push_back(statistics);
+    column_statistics.push_back(chunk_column_statistics);
+  }
+  // Bitmap indexes need dictionary-encoded segments, whose statistics always hold the distinct count.
+  for (auto column_id = ColumnID{0}; column_id < segment_count; ++column_id) {
+    const auto distinct_count = segment_statistics[column_id]->distinct_count();
+    if (_column_bitmap_indexes[column_id] && decisions[column_id].encoding_type == EncodingType::Dictionary &&
+        distinct_count && *distinct_count <= BitmapIndex::MAX_DISTINCT_VALUE_COUNT) {
+      compressed_chunk->create_bitmap_index(column_id);
+    }
   }
+  compressed_chunk->set_segment_statistics(std::move(segment_statistics));
+  // The indexes of the chunk point to its ValueSegments. They are rebuilt over the compressed segments.
+  compressed_chunk->create_indexes_like(*chunk);
+
+  // Merge the statistics of the chunk into those of the table. Merging never looks at the data again, so this is cheap
+  // compared to the compression.
+  const auto chunk_statistics = std::make_shared<TableStatistics>(chunk->size(), std::move(column_statistics));
+  _table_statistics = _table_statistics ? _table_statistics->merged(*chunk_statistics) : chunk_statistics;
 
   // Swap out old chunk with compressed chunk. Old chunk will stay valid until all references to it are dropped.
   // Since we force appends into a new chunk before compression, this should not lead to any data races.
   _chunks[chunk_id] = compressed_chunk;
+  return decisions;
 }
 
 }  // namespace opossum
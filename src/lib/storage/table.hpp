@@ -2,10 +2,12 @@
 
 #include "abstract_segment.hpp"
 #include "chunk.hpp"
+#include "encoding_advisor.hpp"
 #include "type_cast.hpp"
 
 namespace opossum {
 
+class AbstractUniqueHashIndex;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -38,6 +40,9 @@ class Table : private Noncopyable {
   // Returns the column type of the nth column.
   const std::string& column_type(const ColumnID column_id) const;
 
+  // Returns the data type of the nth column.
+  DataType column_data_type(const ColumnID column_id) const;
+
   // Returns whether the nth column can contain NULL values.
   bool column_nullable(const ColumnID column_id) const;
 
@@ -51,32 +56,91 @@ class Table : private Noncopyable {
   // Adds column definition without creating the actual columns. This is helpful when, e.g., an operator first creates
   // the structure of the table and then adds chunk by chunk.
   void add_column_definition(const std::string& name, const std::string& type, const bool nullable);
+  void add_column_definition(const std::string& name, const DataType data_type, const bool nullable);
 
   // Adds a column to the end, i.e., right, of the table. This can only be done if the table does not yet have any
   // entries, because we would otherwise have to deal with default values.
   void add_column(const std::string& name, const std::string& type, const bool nullable);
+  void add_column(const std::string& name, const DataType data_type, const bool nullable);
 
-  // Inserts a row at the end of the table. Note this is slow and not thread-safe and should be used for testing
-  // purposes only.
+  // Inserts a row at the end of the table and adds it to the unique indexes. Fails without modifying the table if the
+  // row has a NULL or an existing value in a column with a unique index. Note this is slow and not thread-safe and
+  // should be used for testing purposes only.
   void append(const std::vector<AllTypeVariant>& values);
 
   // Creates a new chunk and appends it.
   void create_new_chunk();
 
-  // Compresses a ValueColumn into a DictionaryColumn.
-  void compress_chunk(const ChunkID chunk_id);
+  // Appends an existing chunk, e.g., the output of an operator. If the table only holds its initial empty chunk, the
+  // chunk replaces it. The rows are added to the unique indexes.
+  void emplace_chunk(const std::shared_ptr<Chunk>& chunk);
+
+  // Forces the given encoding for the nth column in all subsequent calls of compress_chunk without an explicit
+  // encoding. Pass std::nullopt to let the EncodingAdvisor choose again.
+  void set_column_encoding(const ColumnID column_id, const std::optional<EncodingType> encoding_type);
+
+  // Returns the encoding forced for the nth column, or std::nullopt if the EncodingAdvisor chooses.
+  std::optional<EncodingType> column_encoding(const ColumnID column_id) const;
+
+  // Enables or disables Bloom filters for the nth column in all subsequent calls of compress_chunk. They let TableScan
+  // skip chunks for equality predicates on high-cardinality columns, where min/max pruning rarely helps, at the cost of
+  // about ten bits per distinct value.
+  void set_column_bloom_filter(const ColumnID column_id, const bool enabled);
+
+  // Returns whether compress_chunk builds Bloom filters for the nth column.
+  bool column_bloom_filter(const ColumnID column_id) const;
+
+  // Enables or disables bitmap indexes (see BitmapIndex) for the nth column in all subsequent calls of compress_chunk.
+  // They let BitmapScan combine predicates on several low-cardinality columns with bitmap operations. Only chunks whose
+  // segment is dictionary-encoded and has at most BitmapIndex::MAX_DISTINCT_VALUE_COUNT distinct values get one.
+  void set_column_bitmap_index(const ColumnID column_id, const bool enabled);
+
+  // Returns whether compress_chunk builds bitmap indexes for the nth column.
+  bool column_bitmap_index(const ColumnID column_id) const;
+
+  // Compresses the ValueSegments of a chunk. If an encoding is given, all segments are encoded with it. Otherwise,
+  // each segment uses its column's forced encoding or, if there is none, the encoding the EncodingAdvisor estimates to
+  // be the cheapest. Columns whose data type is not supported by the encoding are dictionary-encoded. The compressed
+  // chunk also stores the statistics of each segment (see Chunk::segment_statistics), including Bloom filters for the
+  // columns that enabled them, and the bitmap indexes of the columns that enabled them. Indexes created on the chunk
+  // before (see Chunk::create_index) are rebuilt over the compressed segments. The chunk's statistics are merged into
+  // the table statistics. Returns the encoding and memory usage of each segment.
+  std::vector<EncodingDecision> compress_chunk(const ChunkID chunk_id,
+                                               const std::optional<EncodingType> encoding_type = std::nullopt);
+
+  // Creates a hash index that maps each value of the nth column to its row, so that point lookups (see
+  // UniqueIndexLookup) do not scan the table. The column must not contain NULLs or duplicates. The index is maintained
+  // by all subsequent appends, which fail for rows that would violate this.
+  void add_unique_index(const ColumnID column_id);
+
+  // Returns the unique index of the nth column, or nullptr if there is none.
+  std::shared_ptr<const AbstractUniqueHashIndex> unique_index(const ColumnID column_id) const;
+
+  // Returns the statistics of all compressed chunks for cardinality estimation, or nullptr if no chunk has been
+  // compressed yet.
+  std::shared_ptr<const TableStatistics> table_statistics() const;
 
  protected:
   // Maximum number of tuples stored in one chunk
   ChunkOffset _max_chunk_size;
   // Names of the columns, in order of insertion
   std::vector<std::string> _column_names;
-  // Types of the columns, in order of insertion (see oppossum::detail::type_strings for possible values)
-  std::vector<std::string> _column_types;
+  // Types of the columns, in order of insertion
+  std::vector<DataType> _column_types;
   // Nullability of the columns, in order of insertion
   std::vector<bool> _column_nullable;
+  // Forced encodings of the columns, in order of insertion
+  std::vector<std::optional<EncodingType>> _column_encodings;
+  // Whether compress_chunk builds Bloom filters for the columns, in order of insertion
+  std::vector<bool> _column_bloom_filters;
+  // Whether compress_chunk builds bitmap indexes for the columns, in order of insertion
+  std::vector<bool> _column_bitmap_indexes;
+  // Unique indexes of the columns, in order of insertion. Columns without a unique index hold nullptr.
+  std::vector<std::shared_ptr<AbstractUniqueHashIndex>> _unique_indexes;
   // Chunks of the table
   std::vector<std::shared_ptr<Chunk>> _chunks;
+  // Statistics of the compressed chunks
+  std::shared_ptr<const TableStatistics> _table_statistics;
 };
 
 }  // namespace opossum
@@ -0,0 +1,46 @@
+#include "table_statistics.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableStatistics::TableStatistics(const uint64_t row_count,
+                                 std::vector<std::shared_ptr<const AbstractColumnStatistics>> column_statistics)
+    : _row_count{row_count}, _column_statistics{std::move(column_statistics)} {}
+
+uint64_t TableStatistics::row_count() const {
+  return _row_count;
+}
+
+ColumnCount TableStatistics::column_count() const {
+  return ColumnCount(_column_statistics.size());
+}
+
+const std::shared_ptr<const AbstractColumnStatistics>& TableStatistics::column_statistics(
+    const ColumnID column_id) const {
+  Assert(column_id < _column_statistics.size(), "Column with ID " + std::to_string(column_id) + " does not exist.");
+  return _column_statistics[column_id];
+}
+
+double TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& search_value) const {
+  return column_statistics(column_id)->estimate_selectivity(scan_type, search_value);
+}
+
+double TableStatistics::estimate_cardinality(const ColumnID column_id, const ScanType scan_type,
+                                             const AllTypeVariant& search_value) const {
+  return estimate_selectivity(column_id, scan_type, search_value) * static_cast<double>(_row_count);
+}
+
+std::shared_ptr<TableStatistics> TableStatistics::merged(const TableStatistics& other) const {
+  Assert(column_count() == other.column_count(), "Cannot merge statistics of tables with different columns.");
+  const auto column_count = _column_statistics.size();
+  auto column_statistics = std::vector<std::shared_ptr<const AbstractColumnStatistics>>{};
+  column_statistics.reserve(column_count);
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    column_statistics.push_back(_column_statistics[column_id]->merged(*other._column_statistics[column_id]));
+  }
+  return std::make_shared<TableStatistics>(_row_count + other._row_count, std::move(column_statistics));
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "column_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// TableStatistics hold the AbstractColumnStatistics of all columns of a table to estimate the cardinality of
+// predicates, e.g., to order them or to choose a join implementation. Table::compress_chunk computes the statistics of
+// each compressed chunk and merges them into those of the table, so they cover the compressed chunks only.
+class TableStatistics : private Noncopyable {
+ public:
+  TableStatistics(const uint64_t row_count,
+                  std::vector<std::shared_ptr<const AbstractColumnStatistics>> column_statistics);
+
+  // Returns the number of rows the statistics describe.
+  uint64_t row_count() const;
+
+  ColumnCount column_count() const;
+
+  const std::shared_ptr<const AbstractColumnStatistics>& column_statistics(const ColumnID column_id) const;
+
+  // Returns the estimated fraction of rows for which "value <scan_type> search_value" holds in the given column.
+  double estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                              const AllTypeVariant& search_value) const;
+
+  // Returns the estimated number of rows for which "value <scan_type> search_value" holds in the given column.
+  double estimate_cardinality(const ColumnID column_id, const ScanType scan_type,
+                              const AllTypeVariant& search_value) const;
+
+  // Returns statistics that describe the rows of both this and other, which must have the same columns.
+  std::shared_ptr<TableStatistics> merged(const TableStatistics& other) const;
+
+ protected:
+  const uint64_t _row_count;
+  const std::vector<std::shared_ptr<const AbstractColumnStatistics>> _column_statistics;
+};
+
+}  // namespace opossum
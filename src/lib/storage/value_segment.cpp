@@ -68,6 +68,16 @@ ChunkOffset ValueSegment<T>::size() const {
   return _values.size();
 }
 
+template <typename T>
+DataType ValueSegment<T>::data_type() const {
+  return data_type_of<T>;
+}
+
+template <typename T>
+SegmentType ValueSegment<T>::segment_type() const {
+  return SegmentType::Value;
+}
+
 template <typename T>
 const std::vector<T>& ValueSegment<T>::values() const {
   return _values;
@@ -79,11 +89,16 @@ bool ValueSegment<T>::is_nullable() const {
 }
 
 template <typename T>
-const std::vector<bool>& ValueSegment<T>::null_values() const {
+const NullBitmap& ValueSegment<T>::null_values() const {
   Assert(is_nullable(), "ValueSegment is not nullable.");
   return _null_values;
 }
 
+template <typename T>
+bool ValueSegment<T>::has_null_values() const {
+  return _null_values.has_nulls();
+}
+
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
   return values().capacity() * sizeof(T);
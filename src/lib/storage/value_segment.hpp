@@ -1,6 +1,7 @@
 #pragma once
 
 #include "abstract_segment.hpp"
+#include "null_bitmap.hpp"
 
 namespace opossum {
 
@@ -28,6 +29,10 @@ class ValueSegment : public AbstractSegment {
   // Returns the number of entries.
   ChunkOffset size() const final;
 
+  DataType data_type() const final;
+
+  SegmentType segment_type() const final;
+
   // Returns all values. This is the preferred method to check a value at a certain index. Usually you need to access
   // more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
@@ -36,10 +41,13 @@ class ValueSegment : public AbstractSegment {
   // Returns whether segment supports NULL values.
   bool is_nullable() const;
 
-  // Returns NULL value vector that indicates whether a value is NULL with true at position i. Throw an exception if
+  // Returns NULL value bitmap that indicates whether a value is NULL with true at position i. Throw an exception if
   // is_nullable() returns false. This is the preferred method to check for a NULL value at a certain index. Usually
   // you need to access more than a single value anyway.
-  const std::vector<bool>& null_values() const;
+  const NullBitmap& null_values() const;
+
+  // Returns whether any value is NULL. Operators can skip NULL handling entirely if this returns false.
+  bool has_null_values() const;
 
   // Returns the calculated memory usage.
   size_t estimate_memory_usage() const final;
@@ -49,8 +57,8 @@ class ValueSegment : public AbstractSegment {
   bool _is_nullable;
   // All values, unspecified entry for null values
   std::vector<T> _values;
-  // One bool for each value: false for valid, true for invalid values (i.e. NULL)
-  std::vector<bool> _null_values;
+  // One bit for each value: false for valid, true for invalid values (i.e. NULL)
+  NullBitmap _null_values;
 };
 
 EXPLICITLY_DECLARE_DATA_TYPES(ValueSegment);
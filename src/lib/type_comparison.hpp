@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <type_traits>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Calls functor with the comparator of the given scan type, so that the scan type is resolved once per segment instead
+// of once per row.
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      functor(std::equal_to<>{});
+      return;
+    case ScanType::OpNotEquals:
+      functor(std::not_equal_to<>{});
+      return;
+    case ScanType::OpLessThan:
+      functor(std::less<>{});
+      return;
+    case ScanType::OpLessThanEquals:
+      functor(std::less_equal<>{});
+      return;
+    case ScanType::OpGreaterThan:
+      functor(std::greater<>{});
+      return;
+    case ScanType::OpGreaterThanEquals:
+      functor(std::greater_equal<>{});
+      return;
+  }
+  Fail("Unknown scan type.");
+}
+
+// Returns whether the value is NaN, which is neither smaller, equal, nor larger than any value. Thus, a NaN search
+// value only satisfies OpNotEquals.
+template <typename T>
+bool is_nan(const T& value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return std::isnan(value);
+  } else {
+    return false;
+  }
+}
+
+}  // namespace opossum
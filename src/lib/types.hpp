@@ -71,6 +71,13 @@ constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max(
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+// Target encodings for Table::compress_chunk. Encodings that are not defined for a column's data type (e.g.,
+// FrameOfReference for strings, see is_encoding_supported) fall back to Dictionary.
+enum class EncodingType { Dictionary, RunLength, FrameOfReference, FSST, ALP };
+
+// Concrete segment classes, see resolve_segment_type.
+enum class SegmentType { Value, Dictionary, RunLength, FrameOfReference, FSST, ALP, Reference };
+
 using PosList = std::vector<RowID>;
 
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
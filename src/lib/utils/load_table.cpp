@@ -39,8 +39,11 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
   const auto table = std::make_shared<Table>(chunk_size);
   const auto column_count = column_names.size();
   Assert(column_types.size() == column_count, "Mismatching number of column types.");
+  auto data_types = std::vector<DataType>{};
+  data_types.reserve(column_count);
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-    table->add_column(column_names[column_id], column_types[column_id], false);
+    data_types.push_back(data_type_from_string(column_types[column_id]));
+    table->add_column(column_names[column_id], data_types.back(), false);
   }
 
   while (std::getline(infile, line)) {
@@ -50,7 +53,7 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
     variant_values.reserve(column_count);
 
     for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-      resolve_data_type(column_types[column_id], [&](auto data_type_t) {
+      resolve_data_type(data_types[column_id], [&](auto data_type_t) {
         using ColumnDataType = typename decltype(data_type_t)::type;
         variant_values.emplace_back(boost::lexical_cast<ColumnDataType>(string_values[column_id]));
       });
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace opossum {
+
+// Hashes a value for probabilistic data structures (e.g., BloomFilter or HyperLogLog) that need well-distributed bits.
+// std::hash is the identity for integers on common standard libraries, so its result is mixed to spread the bits over
+// the whole hash.
+template <typename T>
+uint64_t value_hash(const T& value) {
+  auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+  // Finalizer of MurmurHash3.
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+}  // namespace opossum
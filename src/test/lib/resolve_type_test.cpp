@@ -0,0 +1,79 @@
+#include "base_test.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ResolveTypeTest : public BaseTest {};
+
+TEST_F(ResolveTypeTest, DataTypeStrings) {
+  EXPECT_EQ(data_type_of<int32_t>, DataType::Int);
+  EXPECT_EQ(data_type_of<std::string>, DataType::String);
+
+  EXPECT_EQ(data_type_from_string("long"), DataType::Long);
+  EXPECT_EQ(data_type_from_string("double"), DataType::Double);
+  EXPECT_EQ(data_type_to_string(DataType::Float), "float");
+  EXPECT_THROW(data_type_from_string("bool"), std::logic_error);
+}
+
+TEST_F(ResolveTypeTest, ResolveDataType) {
+  auto is_resolved = false;
+  resolve_data_type(DataType::Long, [&](const auto type) {
+    using Type = typename decltype(type)::type;
+    EXPECT_TRUE((std::is_same_v<Type, int64_t>));
+    is_resolved = true;
+  });
+  EXPECT_TRUE(is_resolved);
+
+  resolve_data_type("string", [&](const auto type) {
+    using Type = typename decltype(type)::type;
+    EXPECT_TRUE((std::is_same_v<Type, std::string>));
+  });
+}
+
+TEST_F(ResolveTypeTest, ResolveSegmentType) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  value_segment->append(3);
+  const auto dictionary_segment = DictionarySegment<int32_t>{value_segment};
+  const auto frame_of_reference_segment = FrameOfReferenceSegment<int32_t>{value_segment};
+
+  EXPECT_EQ(value_segment->data_type(), DataType::Int);
+  EXPECT_EQ(value_segment->segment_type(), SegmentType::Value);
+  EXPECT_EQ(dictionary_segment.segment_type(), SegmentType::Dictionary);
+
+  const auto resolve = [](const AbstractSegment& segment) {
+    auto segment_class_name = std::string{};
+    resolve_data_and_segment_type(segment, [&](const auto type, const auto& typed_segment) {
+      using Type = typename decltype(type)::type;
+      using SegmentClass = std::decay_t<decltype(typed_segment)>;
+      EXPECT_TRUE((std::is_same_v<Type, int32_t>));
+      if constexpr (std::is_same_v<SegmentClass, ValueSegment<Type>>) {
+        segment_class_name = "ValueSegment";
+      } else if constexpr (std::is_same_v<SegmentClass, DictionarySegment<Type>>) {
+        segment_class_name = "DictionarySegment";
+      } else if constexpr (std::is_same_v<SegmentClass, FrameOfReferenceSegment<Type>>) {
+        segment_class_name = "FrameOfReferenceSegment";
+      }
+    });
+    return segment_class_name;
+  };
+  EXPECT_EQ(resolve(*value_segment), "ValueSegment");
+  EXPECT_EQ(resolve(dictionary_segment), "DictionarySegment");
+  EXPECT_EQ(resolve(frame_of_reference_segment), "FrameOfReferenceSegment");
+}
+
+TEST_F(ResolveTypeTest, ReferenceSegmentDataType) {
+  const auto table = std::make_shared<Table>();
+  table->add_column("a", DataType::Double, false);
+  table->append({1.5});
+  EXPECT_EQ(table->column_data_type(ColumnID{0}), DataType::Double);
+  EXPECT_EQ(table->column_type(ColumnID{0}), "double");
+
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{RowID{ChunkID{0}, 0}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  EXPECT_EQ(reference_segment.data_type(), DataType::Double);
+  EXPECT_EQ(reference_segment.segment_type(), SegmentType::Reference);
+}
+
+}  // namespace opossum
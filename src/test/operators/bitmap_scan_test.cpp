@@ -0,0 +1,150 @@
+#include <functional>
+
+#include "base_test.hpp"
+
+#include "operators/bitmap_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/bitmap_index.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class OperatorsBitmapScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Columns (id, country, status, amount). The first two chunks are compressed with bitmap indexes on country and
+    // status, the last one is still mutable.
+    _table = std::make_shared<Table>(20);
+    _table->add_column("id", "int", false);
+    _table->add_column("country", "string", true);
+    _table->add_column("status", "int", false);
+    _table->add_column("amount", "double", false);
+    for (auto row = int32_t{0}; row < 50; ++row) {
+      _table->append({row, country(row), status(row), row * 1.5});
+    }
+    _table->set_column_bitmap_index(ColumnID{1}, true);
+    _table->set_column_bitmap_index(ColumnID{2}, true);
+    _table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+    _table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static AllTypeVariant country(const int32_t row) {
+    const auto countries = std::vector<std::string>{"DE", "FR", "US", "JP"};
+    return row % 9 == 0 ? NULL_VALUE : AllTypeVariant{countries[row % 4]};
+  }
+
+  static int32_t status(const int32_t row) {
+    return row % 3;
+  }
+
+  std::vector<int32_t> output_ids(const std::shared_ptr<const Table>& table) {
+    auto ids = std::vector<int32_t>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        ids.push_back(type_cast<int32_t>((*chunk->get_segment(ColumnID{0}))[chunk_offset]));
+      }
+    }
+    return ids;
+  }
+
+  std::vector<int32_t> expected_ids(const std::function<bool(int32_t)>& predicate) {
+    auto ids = std::vector<int32_t>{};
+    for (auto row = int32_t{0}; row < 50; ++row) {
+      if (predicate(row)) {
+        ids.push_back(row);
+      }
+    }
+    return ids;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsBitmapScanTest, CompressChunkCreatesBitmapIndexes) {
+  EXPECT_TRUE(_table->column_bitmap_index(ColumnID{1}));
+  EXPECT_FALSE(_table->column_bitmap_index(ColumnID{0}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->bitmap_index(ColumnID{1}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->bitmap_index(ColumnID{2}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->bitmap_index(ColumnID{0}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->bitmap_index(ColumnID{1}));
+
+  // Segments with too many distinct values do not get one.
+  auto table = Table{100};
+  table.add_column("id", "int", false);
+  table.set_column_bitmap_index(ColumnID{0}, true);
+  for (auto row = int32_t{0}; row < 100; ++row) {
+    table.append({row % 70});
+  }
+  table.compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->bitmap_index(ColumnID{0}));
+}
+
+TEST_F(OperatorsBitmapScanTest, Conjunction) {
+  const auto predicates = std::vector<ColumnPredicate>{{ColumnID{1}, ScanType::OpNotEquals, "US"},
+                                                       {ColumnID{2}, ScanType::OpEquals, 1},
+                                                       {ColumnID{3}, ScanType::OpLessThan, 60.0}};
+  auto scan = std::make_shared<BitmapScan>(_table_wrapper, predicates, PredicateConnective::And);
+  scan->execute();
+  EXPECT_EQ(output_ids(scan->get_output()), expected_ids([](const auto row) {
+              return !variant_is_null(country(row)) && country(row) != AllTypeVariant{"US"} && status(row) == 1 &&
+                     row * 1.5 < 60.0;
+            }));
+}
+
+TEST_F(OperatorsBitmapScanTest, Disjunction) {
+  const auto predicates = std::vector<ColumnPredicate>{{ColumnID{1}, ScanType::OpEquals, "JP"},
+                                                       {ColumnID{2}, ScanType::OpGreaterThanEquals, 2},
+                                                       {ColumnID{0}, ScanType::OpGreaterThan, 45}};
+  auto scan = std::make_shared<BitmapScan>(_table_wrapper, predicates, PredicateConnective::Or);
+  scan->execute();
+  EXPECT_EQ(output_ids(scan->get_output()), expected_ids([](const auto row) {
+              return country(row) == AllTypeVariant{"JP"} || status(row) >= 2 || row > 45;
+            }));
+}
+
+TEST_F(OperatorsBitmapScanTest, PrunedPredicates) {
+  // No chunk holds a status of 5, which the segment statistics show without evaluating the predicate.
+  auto conjunction = std::make_shared<BitmapScan>(
+      _table_wrapper,
+      std::vector<ColumnPredicate>{{ColumnID{1}, ScanType::OpEquals, "DE"}, {ColumnID{2}, ScanType::OpEquals, 5}},
+      PredicateConnective::And);
+  conjunction->execute();
+  EXPECT_EQ(conjunction->get_output()->row_count(), 0);
+  EXPECT_EQ(conjunction->get_output()->chunk_count(), 1);
+
+  auto disjunction = std::make_shared<BitmapScan>(
+      _table_wrapper,
+      std::vector<ColumnPredicate>{{ColumnID{1}, ScanType::OpEquals, "DE"}, {ColumnID{2}, ScanType::OpEquals, 5}},
+      PredicateConnective::Or);
+  disjunction->execute();
+  EXPECT_EQ(output_ids(disjunction->get_output()),
+            expected_ids([](const auto row) { return country(row) == AllTypeVariant{"DE"}; }));
+}
+
+TEST_F(OperatorsBitmapScanTest, ScanOnReferenceSegments) {
+  // The output of another scan has no bitmap indexes, so all predicates scan their segments.
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 10);
+  table_scan->execute();
+  const auto predicates = std::vector<ColumnPredicate>{{ColumnID{1}, ScanType::OpEquals, "FR"},
+                                                       {ColumnID{2}, ScanType::OpNotEquals, 0}};
+  auto scan = std::make_shared<BitmapScan>(table_scan, predicates, PredicateConnective::And);
+  scan->execute();
+  EXPECT_EQ(output_ids(scan->get_output()), expected_ids([](const auto row) {
+              return row >= 10 && country(row) == AllTypeVariant{"FR"} && status(row) != 0;
+            }));
+
+  const auto segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ(std::static_pointer_cast<const ReferenceSegment>(segment)->referenced_table(), _table);
+}
+
+TEST_F(OperatorsBitmapScanTest, InvalidArguments) {
+  EXPECT_THROW(BitmapScan(_table_wrapper, {}, PredicateConnective::And), std::logic_error);
+}
+
+}  // namespace opossum
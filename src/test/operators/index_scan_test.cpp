@@ -0,0 +1,182 @@
+#include <functional>
+
+#include "base_test.hpp"
+
+#include "operators/index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/index/composite_index.hpp"
+
+namespace opossum {
+
+class OperatorsIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Columns (tenant_id, event_type, day). The first chunk is indexed, the second one is scanned column by column.
+    _table = std::make_shared<Table>(20);
+    _table->add_column("tenant_id", "int", false);
+    _table->add_column("event_type", "string", true);
+    _table->add_column("day", "int", false);
+    for (auto row = int32_t{0}; row < 40; ++row) {
+      const auto event_type = row % 7 == 0 ? NULL_VALUE : AllTypeVariant{row % 2 == 0 ? "click" : "view"};
+      _table->append({row % 3, event_type, row});
+    }
+    _table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+    _table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _table->get_chunk(ChunkID{0})->create_index<CompositeIndex>({ColumnID{0}, ColumnID{1}, ColumnID{2}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // Returns the days of the rows in the output.
+  std::vector<int32_t> output_days(const std::shared_ptr<const Table>& table) {
+    auto days = std::vector<int32_t>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        days.push_back(type_cast<int32_t>((*chunk->get_segment(ColumnID{2}))[chunk_offset]));
+      }
+    }
+    return days;
+  }
+
+  // Returns the days of the rows that match the predicates, computed from the days themselves.
+  std::vector<int32_t> expected_days(const int32_t tenant_id, const std::string& event_type,
+                                     const std::function<bool(int32_t)>& day_predicate) {
+    auto days = std::vector<int32_t>{};
+    for (auto row = int32_t{0}; row < 40; ++row) {
+      const auto row_event_type = row % 2 == 0 ? "click" : "view";
+      if (row % 3 == tenant_id && row % 7 != 0 && row_event_type == event_type && day_predicate(row)) {
+        days.push_back(row);
+      }
+    }
+    return days;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsIndexScanTest, AllScanTypes) {
+  auto tests = std::map<ScanType, std::function<bool(int32_t, int32_t)>>{};
+  tests[ScanType::OpEquals] = std::equal_to<int32_t>{};
+  tests[ScanType::OpNotEquals] = std::not_equal_to<int32_t>{};
+  tests[ScanType::OpLessThan] = std::less<int32_t>{};
+  tests[ScanType::OpLessThanEquals] = std::less_equal<int32_t>{};
+  tests[ScanType::OpGreaterThan] = std::greater<int32_t>{};
+  tests[ScanType::OpGreaterThanEquals] = std::greater_equal<int32_t>{};
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}, ColumnID{2}};
+  for (const auto& test : tests) {
+    // Day 4 falls into the indexed chunk, day 22 into the other one.
+    for (const auto day : {int32_t{4}, int32_t{22}}) {
+      auto scan = std::make_shared<IndexScan>(_table_wrapper, column_ids, test.first,
+                                              std::vector<AllTypeVariant>{1, "click", day});
+      scan->execute();
+      const auto predicate = [&](const auto row_day) { return test.second(row_day, day); };
+      EXPECT_EQ(output_days(scan->get_output()), expected_days(1, "click", predicate));
+    }
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, MatchesChainedTableScans) {
+  auto index_scan = std::make_shared<IndexScan>(_table_wrapper, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+                                                ScanType::OpGreaterThanEquals, std::vector<AllTypeVariant>{2, "view"});
+  index_scan->execute();
+
+  auto scan_tenant = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 2);
+  scan_tenant->execute();
+  auto scan_event_type =
+      std::make_shared<TableScan>(scan_tenant, ColumnID{1}, ScanType::OpGreaterThanEquals, "view");
+  scan_event_type->execute();
+
+  EXPECT_EQ(output_days(index_scan->get_output()), output_days(scan_event_type->get_output()));
+  EXPECT_EQ(output_days(index_scan->get_output()), expected_days(2, "view", [](const auto) { return true; }));
+}
+
+TEST_F(OperatorsIndexScanTest, EmptyResult) {
+  for (const auto& search_values : {std::vector<AllTypeVariant>{5, "click"},
+                                    std::vector<AllTypeVariant>{1, NULL_VALUE}}) {
+    auto scan = std::make_shared<IndexScan>(_table_wrapper, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+                                            ScanType::OpLessThan, search_values);
+    scan->execute();
+    const auto output = scan->get_output();
+    EXPECT_EQ(output->row_count(), 0);
+    EXPECT_EQ(output->chunk_count(), 1);
+    EXPECT_EQ(output->column_count(), 3);
+  }
+}
+
+TEST_F(OperatorsIndexScanTest, IndexesAgreeWithScansOnNaN) {
+  // Columns (tenant_id, value, day). NaN only satisfies "!=", whether or not a CompositeIndex covers the chunks.
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto make_table = [&](const bool indexed) {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("tenant_id", "int", false);
+    table->add_column("value", "float", true);
+    table->add_column("day", "int", false);
+    for (auto row = int32_t{0}; row < 20; ++row) {
+      const auto value = row % 5 == 0 ? AllTypeVariant{nan} : AllTypeVariant{static_cast<float>(row % 4)};
+      table->append({row % 2, row == 7 ? NULL_VALUE : value, row});
+    }
+    if (indexed) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        table->get_chunk(chunk_id)->create_index<CompositeIndex>({ColumnID{0}, ColumnID{1}});
+        table->get_chunk(chunk_id)->create_index<CompositeIndex>({ColumnID{1}});
+      }
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto indexed_table = make_table(true);
+  const auto scanned_table = make_table(false);
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto value : {2.0f, 9.0f, nan}) {
+      const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+      const auto search_values = std::vector<AllTypeVariant>{0, value};
+      auto index_scan = std::make_shared<IndexScan>(indexed_table, column_ids, scan_type, search_values);
+      index_scan->execute();
+      auto column_scan = std::make_shared<IndexScan>(scanned_table, column_ids, scan_type, search_values);
+      column_scan->execute();
+      EXPECT_EQ(output_days(index_scan->get_output()), output_days(column_scan->get_output()));
+
+      // TableScan uses the single-column CompositeIndex.
+      auto indexed_table_scan = std::make_shared<TableScan>(indexed_table, ColumnID{1}, scan_type, value);
+      indexed_table_scan->execute();
+      auto table_scan = std::make_shared<TableScan>(scanned_table, ColumnID{1}, scan_type, value);
+      table_scan->execute();
+      EXPECT_EQ(output_days(indexed_table_scan->get_output()), output_days(table_scan->get_output()));
+    }
+  }
+
+  auto greater_scan = std::make_shared<IndexScan>(indexed_table, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+                                                  ScanType::OpGreaterThanEquals, std::vector<AllTypeVariant>{0, 2.0f});
+  greater_scan->execute();
+  EXPECT_EQ(output_days(greater_scan->get_output()), (std::vector<int32_t>{2, 6, 14, 18}));
+}
+
+TEST_F(OperatorsIndexScanTest, InvalidArguments) {
+  EXPECT_THROW(IndexScan(_table_wrapper, {ColumnID{0}, ColumnID{1}}, ScanType::OpEquals, {1}), std::logic_error);
+  EXPECT_THROW(IndexScan(_table_wrapper, {}, ScanType::OpEquals, {}), std::logic_error);
+}
+
+TEST_F(OperatorsIndexScanTest, ScanOnReferenceSegments) {
+  // The output of another scan is scanned column by column and references the original table.
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, 1);
+  table_scan->execute();
+  auto scan = std::make_shared<IndexScan>(table_scan, std::vector<ColumnID>{ColumnID{1}, ColumnID{2}},
+                                          ScanType::OpLessThan, std::vector<AllTypeVariant>{"click", 30});
+  scan->execute();
+  EXPECT_EQ(output_days(scan->get_output()), expected_days(1, "click", [](const auto day) { return day < 30; }));
+
+  const auto segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ(std::static_pointer_cast<const ReferenceSegment>(segment)->referenced_table(), _table);
+}
+
+}  // namespace opossum
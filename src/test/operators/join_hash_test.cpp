@@ -0,0 +1,194 @@
+#include "base_test.hpp"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Orders (order_id, customer_id, amount) and customers (customer_id, name). Customer 4 has no orders, and some
+    // orders have no customer or one that does not exist.
+    auto orders = std::make_shared<Table>(4);
+    orders->add_column("order_id", "int", false);
+    orders->add_column("customer_id", "int", true);
+    orders->add_column("amount", "float", false);
+    for (auto order_id = int32_t{0}; order_id < 14; ++order_id) {
+      const auto customer_id = order_id % 5 == 4 ? NULL_VALUE : AllTypeVariant{order_id % 6};
+      orders->append({order_id, customer_id, 10.5f * static_cast<float>(order_id)});
+    }
+    orders->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+    orders->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _orders = std::make_shared<TableWrapper>(orders);
+    _orders->execute();
+
+    auto customers = std::make_shared<Table>(3);
+    customers->add_column("customer_id", "int", false);
+    customers->add_column("name", "string", false);
+    for (const auto& [customer_id, name] : std::vector<std::pair<int32_t, std::string>>{
+             {0, "Ada"}, {1, "Grace"}, {2, "Edsger"}, {3, "Barbara"}, {4, "Donald"}, {1, "Grace II"}}) {
+      customers->append({customer_id, name});
+    }
+    customers->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+    _customers = std::make_shared<TableWrapper>(customers);
+    _customers->execute();
+  }
+
+  // Joins the tables with nested loops, with the output schema of JoinHash.
+  static std::shared_ptr<Table> nested_loop_join(const Table& left, const Table& right, const ColumnID left_column_id,
+                                                 const ColumnID right_column_id) {
+    auto result = std::make_shared<Table>();
+    for (auto column_id = ColumnID{0}; column_id < left.column_count(); ++column_id) {
+      result->add_column(left.column_name(column_id), left.column_type(column_id), left.column_nullable(column_id));
+    }
+    for (auto column_id = ColumnID{0}; column_id < right.column_count(); ++column_id) {
+      const auto& left_names = left.column_names();
+      const auto& name = right.column_name(column_id);
+      const auto is_duplicate = std::find(left_names.begin(), left_names.end(), name) != left_names.end();
+      result->add_column(is_duplicate ? name + "_right" : name, right.column_type(column_id),
+                         right.column_nullable(column_id));
+    }
+
+    const auto left_rows = rows(left);
+    const auto right_rows = rows(right);
+    for (const auto& left_row : left_rows) {
+      for (const auto& right_row : right_rows) {
+        const auto& left_value = left_row[left_column_id];
+        const auto& right_value = right_row[right_column_id];
+        if (!variant_is_null(left_value) && !variant_is_null(right_value) && left_value == right_value) {
+          auto row = left_row;
+          row.insert(row.end(), right_row.begin(), right_row.end());
+          result->append(row);
+        }
+      }
+    }
+    return result;
+  }
+
+  static std::vector<std::vector<AllTypeVariant>> rows(const Table& table) {
+    auto result = std::vector<std::vector<AllTypeVariant>>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        auto& row = result.emplace_back();
+        for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+          row.push_back((*chunk->get_segment(column_id))[chunk_offset]);
+        }
+      }
+    }
+    return result;
+  }
+
+  std::shared_ptr<TableWrapper> _orders;
+  std::shared_ptr<TableWrapper> _customers;
+};
+
+TEST_F(OperatorsJoinHashTest, JoinsIntegerColumns) {
+  for (const auto& [left, right, left_column_id, right_column_id] :
+       {std::tuple{_orders, _customers, ColumnID{1}, ColumnID{0}},
+        std::tuple{_customers, _orders, ColumnID{0}, ColumnID{1}}}) {
+    auto join = std::make_shared<JoinHash>(left, right, left_column_id, right_column_id);
+    join->execute();
+    const auto expected =
+        nested_loop_join(*left->get_output(), *right->get_output(), left_column_id, right_column_id);
+    EXPECT_TABLE_EQ(join->get_output(), expected);
+    EXPECT_EQ(join->get_output()->column_name(ColumnID{3}), "customer_id_right");
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, JoinsStringColumns) {
+  // Self-join on the name, which matches every customer with itself.
+  auto join = std::make_shared<JoinHash>(_customers, _customers, ColumnID{1}, ColumnID{1});
+  join->execute();
+  const auto& output = join->get_output();
+  EXPECT_EQ(output->row_count(), 6);
+  EXPECT_TABLE_EQ(output, nested_loop_join(*_customers->get_output(), *_customers->get_output(), ColumnID{1},
+                                           ColumnID{1}));
+}
+
+TEST_F(OperatorsJoinHashTest, OutputReferencesInputTables) {
+  // Join the results of scans. The output references the scanned tables instead of the scan results.
+  auto order_scan = std::make_shared<TableScan>(_orders, ColumnID{0}, ScanType::OpGreaterThanEquals, 3);
+  order_scan->execute();
+  auto customer_scan = std::make_shared<TableScan>(_customers, ColumnID{0}, ScanType::OpLessThan, 3);
+  customer_scan->execute();
+
+  auto join = std::make_shared<JoinHash>(order_scan, customer_scan, ColumnID{1}, ColumnID{0});
+  join->execute();
+  const auto& output = join->get_output();
+  EXPECT_TABLE_EQ(output, nested_loop_join(*order_scan->get_output(), *customer_scan->get_output(), ColumnID{1},
+                                           ColumnID{0}));
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < output->column_count(); ++column_id) {
+      const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+      ASSERT_TRUE(segment);
+      EXPECT_EQ(segment->referenced_table(),
+                column_id < 3 ? _orders->get_output() : _customers->get_output());
+    }
+    // Columns of the same input share their position list.
+    const auto pos_list_of = [&](const ColumnID column_id) {
+      return std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id))->pos_list();
+    };
+    EXPECT_EQ(pos_list_of(ColumnID{0}), pos_list_of(ColumnID{2}));
+    EXPECT_EQ(pos_list_of(ColumnID{3}), pos_list_of(ColumnID{4}));
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, EmptyResult) {
+  auto customer_scan = std::make_shared<TableScan>(_customers, ColumnID{0}, ScanType::OpGreaterThan, 4);
+  customer_scan->execute();
+  auto join = std::make_shared<JoinHash>(_orders, customer_scan, ColumnID{1}, ColumnID{0});
+  join->execute();
+
+  const auto& output = join->get_output();
+  EXPECT_EQ(output->column_count(), 5);
+  EXPECT_EQ(output->row_count(), 0);
+  EXPECT_EQ(output->chunk_count(), 1);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->column_count(), 5);
+}
+
+TEST_F(OperatorsJoinHashTest, ParallelJoinMatchesSequentialJoin) {
+  TaskScheduler::get().set_worker_count(4);
+
+  const auto make_table = [](const std::string& prefix, const int32_t row_count, const int32_t modulo) {
+    auto table = std::make_shared<Table>(100);
+    table->add_column(prefix + "_key", "long", false);
+    table->add_column(prefix + "_row", "int", false);
+    for (auto row = int32_t{0}; row < row_count; ++row) {
+      table->append({int64_t{row % modulo}, row});
+    }
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 2) {
+      table->compress_chunk(chunk_id, EncodingType::Dictionary);
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto left = make_table("l", 3'000, 700);
+  const auto right = make_table("r", 1'000, 900);
+
+  auto sequential_join = std::make_shared<JoinHash>(left, right, ColumnID{0}, ColumnID{0});
+  sequential_join->execute();
+  auto parallel_join = std::make_shared<JoinHash>(left, right, ColumnID{0}, ColumnID{0});
+  parallel_join->set_parallel_execution_thresholds(0, 0);
+  parallel_join->execute();
+  TaskScheduler::get().reset();
+
+  // Every right key below 700 matches 4 or 5 left rows.
+  EXPECT_GT(parallel_join->get_output()->row_count(), 3'000);
+  EXPECT_GT(parallel_join->get_output()->chunk_count(), 1);
+  EXPECT_TABLE_EQ(parallel_join->get_output(), sequential_join->get_output());
+}
+
+TEST_F(OperatorsJoinHashTest, RejectsDifferentDataTypes) {
+  auto join = std::make_shared<JoinHash>(_orders, _customers, ColumnID{2}, ColumnID{0});
+  EXPECT_THROW(join->execute(), std::logic_error);
+}
+
+}  // namespace opossum
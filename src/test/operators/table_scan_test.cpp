@@ -3,7 +3,11 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/index/adaptive_radix_tree_index.hpp"
+#include "storage/index/group_key_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_statistics.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
@@ -22,8 +26,8 @@ class OperatorsTableScanTest : public BaseTest {
     }
     test_even_dict->append({25, NULL_VALUE});
 
-    test_even_dict->compress_chunk(ChunkID{0});
-    test_even_dict->compress_chunk(ChunkID{1});
+    test_even_dict->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+    test_even_dict->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
 
     _table_wrapper_even_dict = std::make_shared<TableWrapper>(std::move(test_even_dict));
     _table_wrapper_even_dict->execute();
@@ -38,8 +42,8 @@ class OperatorsTableScanTest : public BaseTest {
       table->append({index, 100.1 + index});
     }
 
-    table->compress_chunk(ChunkID{0});
-    table->compress_chunk(ChunkID{1});
+    table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+    table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
 
     auto table_wrapper = std::make_shared<TableWrapper>(table);
     table_wrapper->execute();
@@ -57,7 +61,7 @@ class OperatorsTableScanTest : public BaseTest {
       table->append({index, 100.0f + index});
     }
 
-    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
 
     auto table_wrapper = std::make_shared<opossum::TableWrapper>(std::move(table));
     table_wrapper->execute();
@@ -283,4 +287,476 @@ TEST_F(OperatorsTableScanTest, ScanOnReferenceSegmentWithNullValue) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ScanPrunesChunksBySegmentStatistics) {
+  // Chunks hold the ranges [0, 4], [5, 9], [10, 14], ... Only the chunk holding [10, 14] can contain matches.
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int", false);
+  for (auto index = int32_t{0}; index < 25; ++index) {
+    table->append({index});
+  }
+  // Compressing the last chunk appends a new one, so the chunk count must not be re-evaluated.
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->compress_chunk(chunk_id);
+  }
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->segment_statistics(ColumnID{0})->can_prune(ScanType::OpEquals, 12));
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 12);
+  scan->execute();
+
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->chunk_count(), 1);
+  EXPECT_EQ(output->row_count(), 1);
+  EXPECT_EQ((*output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))[0], AllTypeVariant{12});
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnIndexedDictColumn) {
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int", false);
+  table->add_column("b", "int", true);
+  for (auto index = int32_t{0}; index <= 24; index += 2) {
+    table->append({index, 100 + index});
+  }
+  table->append({25, NULL_VALUE});
+  // Compressing the last chunk appends a new one, so the chunk count must not be re-evaluated.
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->compress_chunk(chunk_id, EncodingType::Dictionary);
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>({ColumnID{0}});
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>({ColumnID{1}});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {104};
+  tests[ScanType::OpNotEquals] = {100, 102, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, NULL_VALUE};
+  tests[ScanType::OpLessThan] = {100, 102};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124, NULL_VALUE};
+  tests[ScanType::OpGreaterThanEquals] = {104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, NULL_VALUE};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 4);
+    scan->execute();
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+
+    // Column "b" holds a + 100, but its NULL never matches.
+    auto nullable_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, test.first, 104);
+    nullable_scan->execute();
+    EXPECT_EQ(nullable_scan->get_output()->row_count(), test.second.size() - variant_is_null(test.second.back()));
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnAdaptiveRadixTreeIndex) {
+  // Unlike the GroupKeyIndex, the ART also indexes columns that are not dictionary-encoded.
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "string", true);
+  for (auto index = int32_t{0}; index < 10; ++index) {
+    table->append({index % 3 == 0 ? NULL_VALUE : AllTypeVariant{std::to_string(index)}});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  table->get_chunk(ChunkID{0})->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {"5"};
+  tests[ScanType::OpNotEquals] = {"1", "2", "4", "7", "8"};
+  tests[ScanType::OpLessThan] = {"1", "2", "4"};
+  tests[ScanType::OpLessThanEquals] = {"1", "2", "4", "5"};
+  tests[ScanType::OpGreaterThan] = {"7", "8"};
+  tests[ScanType::OpGreaterThanEquals] = {"5", "7", "8"};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, "5");
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), test.second.size());
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnAdaptiveRadixTreeIndexWithNaN) {
+  // NaN only satisfies "!=", with and without an index.
+  const auto make_table = [](const bool indexed) {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "float", false);
+    for (const auto value : {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, std::numeric_limits<float>::quiet_NaN()}) {
+      table->append({value});
+    }
+    if (indexed) {
+      table->get_chunk(ChunkID{0})->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto indexed_table = make_table(true);
+  const auto value_table = make_table(false);
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    auto index_scan = std::make_shared<TableScan>(indexed_table, ColumnID{0}, scan_type, 2.0f);
+    index_scan->execute();
+    auto value_scan = std::make_shared<TableScan>(value_table, ColumnID{0}, scan_type, 2.0f);
+    value_scan->execute();
+    EXPECT_EQ(index_scan->get_output()->row_count(), value_scan->get_output()->row_count());
+  }
+
+  auto greater_scan = std::make_shared<TableScan>(indexed_table, ColumnID{0}, ScanType::OpGreaterThan, 2.0f);
+  greater_scan->execute();
+  EXPECT_EQ(greater_scan->get_output()->row_count(), 2);
+  auto not_equals_scan = std::make_shared<TableScan>(indexed_table, ColumnID{0}, ScanType::OpNotEquals, 2.0f);
+  not_equals_scan->execute();
+  EXPECT_EQ(not_equals_scan->get_output()->row_count(), 5);
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnMatchesValueColumn) {
+  // Dictionary segments are scanned via their ValueIDs. Compare with the results on unencoded segments, including
+  // search values outside of the dictionary and chunks with and without NULLs.
+  const auto make_table = [](const bool compress) {
+    auto table = std::make_shared<Table>(6);
+    table->add_column("a", "string", true);
+    for (const auto& value : {"delta", "bravo", "delta", "echo", "alpha", "delta", "kilo", "lima", "kilo"}) {
+      table->append({value});
+    }
+    table->append({NULL_VALUE});
+    if (compress) {
+      table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+      table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto dictionary_table = make_table(true);
+  const auto value_table = make_table(false);
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto& search_value : {"a", "alpha", "charlie", "delta", "echo", "kilo", "lima", "zulu"}) {
+      auto dictionary_scan = std::make_shared<TableScan>(dictionary_table, ColumnID{0}, scan_type, search_value);
+      dictionary_scan->execute();
+      auto value_scan = std::make_shared<TableScan>(value_table, ColumnID{0}, scan_type, search_value);
+      value_scan->execute();
+      EXPECT_TABLE_EQ(dictionary_scan->get_output(), value_scan->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnRunLengthColumnMatchesValueColumn) {
+  // RunLengthSegments are scanned once per run. Compare with the results on unencoded segments, including NULL runs and
+  // runs that span the whole chunk.
+  const auto make_table = [](const bool compress) {
+    auto table = std::make_shared<Table>(8);
+    table->add_column("a", "int", true);
+    for (const auto& value : {AllTypeVariant{3}, AllTypeVariant{3}, AllTypeVariant{1}, NULL_VALUE, NULL_VALUE,
+                              AllTypeVariant{5}, AllTypeVariant{5}, AllTypeVariant{3}, AllTypeVariant{2},
+                              AllTypeVariant{2}, AllTypeVariant{2}, AllTypeVariant{2}, AllTypeVariant{2},
+                              AllTypeVariant{2}, AllTypeVariant{2}, AllTypeVariant{2}, AllTypeVariant{4}}) {
+      table->append({value});
+    }
+    if (compress) {
+      table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+      table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto run_length_table = make_table(true);
+  const auto value_table = make_table(false);
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto search_value : {0, 1, 2, 3, 4, 5, 6}) {
+      auto run_length_scan = std::make_shared<TableScan>(run_length_table, ColumnID{0}, scan_type, search_value);
+      run_length_scan->execute();
+      auto value_scan = std::make_shared<TableScan>(value_table, ColumnID{0}, scan_type, search_value);
+      value_scan->execute();
+      EXPECT_TABLE_EQ(run_length_scan->get_output(), value_scan->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnFrameOfReferenceColumnMatchesValueColumn) {
+  // FrameOfReferenceSegments are decoded block by block and scanned with the ValueSegment kernels. Compare with the
+  // results on unencoded segments, with several blocks per chunk and NULLs, which decode to the block minimum.
+  const auto make_table = [](const bool compress) {
+    auto table = std::make_shared<Table>(3'000);
+    table->add_column("a", "int", true);
+    for (auto index = int32_t{0}; index < 7'000; ++index) {
+      table->append({index % 11 == 5 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{(index * 37) % 1'000}});
+    }
+    if (compress) {
+      table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+      table->compress_chunk(ChunkID{1}, EncodingType::FrameOfReference);
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto frame_of_reference_table = make_table(true);
+  const auto value_table = make_table(false);
+  EXPECT_EQ(frame_of_reference_table->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0})->segment_type(),
+            SegmentType::FrameOfReference);
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto search_value : {-1, 0, 1, 500, 999, 1'000}) {
+      auto frame_of_reference_scan =
+          std::make_shared<TableScan>(frame_of_reference_table, ColumnID{0}, scan_type, search_value);
+      frame_of_reference_scan->execute();
+      auto value_scan = std::make_shared<TableScan>(value_table, ColumnID{0}, scan_type, search_value);
+      value_scan->execute();
+      EXPECT_TABLE_EQ(frame_of_reference_scan->get_output(), value_scan->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnALPColumnMatchesValueColumn) {
+  // ALPSegments are decoded block by block and scanned with the ValueSegment kernels. Compare with the results on
+  // unencoded segments, including exceptions (NaN, -0.0, and values that are not short decimals) and NULLs.
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto make_table = [&](const bool compress) {
+    auto table = std::make_shared<Table>(1'500);
+    table->add_column("a", "float", true);
+    table->add_column("id", "int", false);
+    for (auto index = int32_t{0}; index < 3'500; ++index) {
+      if (index % 17 == 3) {
+        table->append({NULL_VALUE, index});
+      } else if (index % 29 == 7) {
+        table->append({index % 2 == 0 ? nan : -0.0f, index});
+      } else if (index % 31 == 11) {
+        table->append({1.0f / static_cast<float>(index), index});
+      } else {
+        table->append({static_cast<float>(index % 100) * 0.5f, index});
+      }
+    }
+    if (compress) {
+      table->compress_chunk(ChunkID{0}, EncodingType::ALP);
+      table->compress_chunk(ChunkID{1}, EncodingType::ALP);
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto output_ids = [](const std::shared_ptr<const Table>& table) {
+    auto ids = std::vector<int32_t>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& segment = *table->get_chunk(chunk_id)->get_segment(ColumnID{1});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        ids.push_back(type_cast<int32_t>(segment[chunk_offset]));
+      }
+    }
+    return ids;
+  };
+  const auto alp_table = make_table(true);
+  const auto value_table = make_table(false);
+  EXPECT_EQ(alp_table->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0})->segment_type(),
+            SegmentType::ALP);
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto search_value : {-1.0f, 0.0f, 0.5f, 24.5f, 49.5f, 100.0f, nan}) {
+      auto alp_scan = std::make_shared<TableScan>(alp_table, ColumnID{0}, scan_type, search_value);
+      alp_scan->execute();
+      auto value_scan = std::make_shared<TableScan>(value_table, ColumnID{0}, scan_type, search_value);
+      value_scan->execute();
+      EXPECT_EQ(output_ids(alp_scan->get_output()), output_ids(value_scan->get_output()));
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnFSSTColumnMatchesValueColumn) {
+  // Equality predicates on FSSTSegments compare compressed values, the other predicates decompress. Compare with the
+  // results on unencoded segments, including search values that contain bytes outside of the symbol table.
+  const auto make_table = [](const bool compress) {
+    auto table = std::make_shared<Table>(6);
+    table->add_column("a", "string", true);
+    for (const auto& value : {AllTypeVariant{"http://example.com/a"}, AllTypeVariant{"http://example.com/ab"},
+                              AllTypeVariant{""}, NULL_VALUE, AllTypeVariant{"http://example.org/a"},
+                              AllTypeVariant{"http://example.com/a"}, AllTypeVariant{"https://example.com/a"},
+                              AllTypeVariant{"http://example.com/a"}, NULL_VALUE, AllTypeVariant{"ftp://example.com"},
+                              AllTypeVariant{"http://example.com/"}, AllTypeVariant{"http://example.com/ab"}}) {
+      table->append({value});
+    }
+    if (compress) {
+      table->compress_chunk(ChunkID{0}, EncodingType::FSST);
+      table->compress_chunk(ChunkID{1}, EncodingType::FSST);
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto fsst_table = make_table(true);
+  const auto value_table = make_table(false);
+  EXPECT_EQ(fsst_table->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0})->segment_type(),
+            SegmentType::FSST);
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto& search_value : {"", "http://example.com/a", "http://example.com/ab", "ftp://example.com",
+                                     "http://example.com/a\xff", "zzz"}) {
+      auto fsst_scan = std::make_shared<TableScan>(fsst_table, ColumnID{0}, scan_type, search_value);
+      fsst_scan->execute();
+      auto value_scan = std::make_shared<TableScan>(value_table, ColumnID{0}, scan_type, search_value);
+      value_scan->execute();
+      EXPECT_TABLE_EQ(fsst_scan->get_output(), value_scan->get_output());
+    }
+  }
+
+  auto equals_scan = std::make_shared<TableScan>(fsst_table, ColumnID{0}, ScanType::OpEquals, "http://example.com/a");
+  equals_scan->execute();
+  EXPECT_EQ(equals_scan->get_output()->row_count(), 3);
+}
+
+TEST_F(OperatorsTableScanTest, ScanForNaNMatchesValueColumn) {
+  // A NaN search value only satisfies "!=", which holds for all non-NULL rows. Dictionary segments, with and without a
+  // GroupKeyIndex, must agree with unencoded segments.
+  const auto make_table = [](const bool compress, const bool indexed) {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "float", true);
+    for (const auto& value : {AllTypeVariant{2.0f}, AllTypeVariant{0.0f}, NULL_VALUE, AllTypeVariant{4.0f},
+                             AllTypeVariant{1.0f}, AllTypeVariant{3.0f}}) {
+      table->append({value});
+    }
+    if (compress) {
+      table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+      table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+    }
+    if (indexed) {
+      table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>({ColumnID{0}});
+      table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>({ColumnID{0}});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto value_table = make_table(false, false);
+  const auto dictionary_tables = {make_table(true, false), make_table(true, true)};
+
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    auto value_scan = std::make_shared<TableScan>(value_table, ColumnID{0}, scan_type, nan);
+    value_scan->execute();
+    EXPECT_EQ(value_scan->get_output()->row_count(), scan_type == ScanType::OpNotEquals ? 5 : 0);
+    for (const auto& dictionary_table : dictionary_tables) {
+      auto dictionary_scan = std::make_shared<TableScan>(dictionary_table, ColumnID{0}, scan_type, nan);
+      dictionary_scan->execute();
+      EXPECT_TABLE_EQ(dictionary_scan->get_output(), value_scan->get_output());
+    }
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnWithStoredNaN) {
+  // Stored NaNs share one dictionary entry behind the ordered values and only satisfy "!=". Dictionary segments, with
+  // and without a GroupKeyIndex, must agree with unencoded segments.
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto make_table = [&](const bool compress, const bool indexed) {
+    auto table = std::make_shared<Table>(5);
+    table->add_column("a", "float", true);
+    table->add_column("id", "int", false);
+    auto id = int32_t{0};
+    for (const auto& value : {AllTypeVariant{3.0f}, AllTypeVariant{nan}, AllTypeVariant{1.0f}, AllTypeVariant{nan},
+                              AllTypeVariant{5.0f}, AllTypeVariant{2.0f}, AllTypeVariant{nan}, AllTypeVariant{4.0f},
+                              NULL_VALUE, AllTypeVariant{nan}}) {
+      table->append({value, id++});
+    }
+    if (compress) {
+      table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+      table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+    }
+    if (indexed) {
+      table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>({ColumnID{0}});
+      table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>({ColumnID{0}});
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto output_ids = [](const std::shared_ptr<const Table>& table) {
+    auto ids = std::vector<int32_t>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& segment = *table->get_chunk(chunk_id)->get_segment(ColumnID{1});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+        ids.push_back(type_cast<int32_t>(segment[chunk_offset]));
+      }
+    }
+    return ids;
+  };
+  const auto value_table = make_table(false, false);
+  const auto dictionary_table = make_table(true, false);
+  const auto dictionary_tables = {dictionary_table, make_table(true, true)};
+
+  const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                           ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+  for (const auto scan_type : scan_types) {
+    for (const auto search_value : {0.5f, 1.0f, 4.0f, 5.0f, 9.0f, nan}) {
+      auto value_scan = std::make_shared<TableScan>(value_table, ColumnID{0}, scan_type, search_value);
+      value_scan->execute();
+      for (const auto& dictionary_table : dictionary_tables) {
+        auto dictionary_scan = std::make_shared<TableScan>(dictionary_table, ColumnID{0}, scan_type, search_value);
+        dictionary_scan->execute();
+        EXPECT_EQ(output_ids(dictionary_scan->get_output()), output_ids(value_scan->get_output()));
+      }
+    }
+  }
+
+  auto equals_scan = std::make_shared<TableScan>(dictionary_table, ColumnID{0}, ScanType::OpEquals, 4.0f);
+  equals_scan->execute();
+  EXPECT_EQ(output_ids(equals_scan->get_output()), (std::vector<int32_t>{7}));
+  auto less_scan = std::make_shared<TableScan>(dictionary_table, ColumnID{0}, ScanType::OpLessThan, 4.0f);
+  less_scan->execute();
+  EXPECT_EQ(output_ids(less_scan->get_output()), (std::vector<int32_t>{0, 2, 5}));
+}
+
+TEST_F(OperatorsTableScanTest, ParallelScanKeepsChunkOrder) {
+  TaskScheduler::get().set_worker_count(4);
+
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int", true);
+  for (auto index = int32_t{0}; index < 2'000; ++index) {
+    table->append({index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index % 100}});
+  }
+  // Mix encodings, so that chunks take different code paths.
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); chunk_id += 3) {
+    table->compress_chunk(chunk_id, EncodingType::Dictionary);
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sequential_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 30);
+  sequential_scan->execute();
+  auto parallel_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 30);
+  parallel_scan->set_parallel_execution_thresholds(0, 0);
+  parallel_scan->execute();
+  TaskScheduler::get().reset();
+
+  EXPECT_TABLE_EQ(parallel_scan->get_output(), sequential_scan->get_output(), true);
+
+  // Output chunks reference the input chunks in ascending order.
+  const auto output = parallel_scan->get_output();
+  auto previous_row_id = std::optional<RowID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& segment = static_cast<const ReferenceSegment&>(*output->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    for (const auto row_id : *segment.pos_list()) {
+      if (previous_row_id) {
+        EXPECT_LT(*previous_row_id, row_id);
+      }
+      previous_row_id = row_id;
+    }
+  }
+}
+
 }  // namespace opossum
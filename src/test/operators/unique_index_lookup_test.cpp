@@ -0,0 +1,75 @@
+#include "base_test.hpp"
+
+#include "operators/table_wrapper.hpp"
+#include "operators/unique_index_lookup.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class OperatorsUniqueIndexLookupTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(10);
+    _table->add_column("id", "string", false);
+    _table->add_column("balance", "int", true);
+    for (auto row = int32_t{0}; row < 25; ++row) {
+      _table->append({"user_" + std::to_string(row), row == 17 ? NULL_VALUE : AllTypeVariant{row * 100}});
+    }
+    _table->compress_chunk(ChunkID{0});
+    _table->add_unique_index(ColumnID{0});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsUniqueIndexLookupTest, FindsRow) {
+  for (const auto row : {int32_t{0}, int32_t{17}, int32_t{24}}) {
+    auto lookup = std::make_shared<UniqueIndexLookup>(_table_wrapper, ColumnID{0}, "user_" + std::to_string(row));
+    lookup->execute();
+    const auto output = lookup->get_output();
+    ASSERT_EQ(output->row_count(), 1);
+    EXPECT_EQ(output->column_count(), 2);
+    EXPECT_EQ(output->column_name(ColumnID{1}), "balance");
+    EXPECT_TRUE(output->column_nullable(ColumnID{1}));
+
+    const auto chunk = output->get_chunk(ChunkID{0});
+    const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk->get_segment(ColumnID{1}));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->referenced_table(), _table);
+    if (row == 17) {
+      EXPECT_TRUE(variant_is_null((*segment)[0]));
+    } else {
+      EXPECT_EQ((*segment)[0], AllTypeVariant{row * 100});
+    }
+  }
+}
+
+TEST_F(OperatorsUniqueIndexLookupTest, FindsAppendedRow) {
+  _table->append({"user_25", 2500});
+  auto lookup = std::make_shared<UniqueIndexLookup>(_table_wrapper, ColumnID{0}, "user_25");
+  lookup->execute();
+  ASSERT_EQ(lookup->get_output()->row_count(), 1);
+  EXPECT_EQ((*lookup->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[0], AllTypeVariant{2500});
+}
+
+TEST_F(OperatorsUniqueIndexLookupTest, MissingValue) {
+  for (const auto& search_value : {AllTypeVariant{"user_99"}, NULL_VALUE}) {
+    auto lookup = std::make_shared<UniqueIndexLookup>(_table_wrapper, ColumnID{0}, search_value);
+    lookup->execute();
+    const auto output = lookup->get_output();
+    EXPECT_EQ(output->row_count(), 0);
+    EXPECT_EQ(output->chunk_count(), 1);
+    EXPECT_EQ(output->get_chunk(ChunkID{0})->column_count(), 2);
+  }
+}
+
+TEST_F(OperatorsUniqueIndexLookupTest, ColumnWithoutIndex) {
+  auto lookup = std::make_shared<UniqueIndexLookup>(_table_wrapper, ColumnID{1}, 100);
+  EXPECT_THROW(lookup->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#include <cmath>
+#include <random>
+
+#include "base_test.hpp"
+
+#include "operators/value_segment_scan.hpp"
+#include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
+
+namespace opossum {
+
+class OperatorsValueSegmentScanTest : public BaseTest {
+ protected:
+  // Compares the kernels with a row-at-a-time scan for all scan types, several segment sizes around the block size of
+  // 64 rows, with and without NULLs.
+  template <typename T>
+  void expect_matches_naive_scan(const std::vector<T>& special_values) {
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int32_t>{-5, 5};
+    const auto scan_types = {ScanType::OpEquals,         ScanType::OpNotEquals,   ScanType::OpLessThan,
+                             ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals};
+
+    for (const auto size : {size_t{0}, size_t{1}, size_t{63}, size_t{64}, size_t{65}, size_t{200}}) {
+      for (const auto nullable : {false, true}) {
+        auto segment = ValueSegment<T>{nullable};
+        for (auto row = size_t{0}; row < size; ++row) {
+          if (nullable && row % 7 == 3) {
+            segment.append(NULL_VALUE);
+          } else if (row % 11 == 5 && !special_values.empty()) {
+            segment.append(special_values[row % special_values.size()]);
+          } else {
+            segment.append(static_cast<T>(distribution(generator)));
+          }
+        }
+
+        for (const auto scan_type : scan_types) {
+          for (const auto search_value : {T{-6}, T{-1}, T{0}, T{3}, T{6}}) {
+            auto expected = std::vector<ChunkOffset>{};
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+              if (segment.is_nullable() && segment.null_values()[chunk_offset]) {
+                continue;
+              }
+              const auto value = segment.values()[chunk_offset];
+              with_comparator(scan_type, [&](const auto comparator) {
+                if (comparator(value, search_value)) {
+                  expected.push_back(chunk_offset);
+                }
+              });
+            }
+
+            auto matches = std::vector<ChunkOffset>{};
+            scan_value_segment(segment, scan_type, search_value, matches);
+            EXPECT_EQ(matches, expected);
+          }
+        }
+      }
+    }
+  }
+};
+
+TEST_F(OperatorsValueSegmentScanTest, Int) {
+  expect_matches_naive_scan<int32_t>({std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()});
+}
+
+TEST_F(OperatorsValueSegmentScanTest, Long) {
+  expect_matches_naive_scan<int64_t>({std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()});
+}
+
+TEST_F(OperatorsValueSegmentScanTest, Float) {
+  expect_matches_naive_scan<float>({std::nanf(""), -0.0f, 0.5f, std::numeric_limits<float>::infinity()});
+}
+
+TEST_F(OperatorsValueSegmentScanTest, Double) {
+  expect_matches_naive_scan<double>({std::nan(""), -0.0, 2.5, -std::numeric_limits<double>::infinity()});
+}
+
+TEST_F(OperatorsValueSegmentScanTest, AppendsToExistingMatches) {
+  auto segment = ValueSegment<int32_t>{};
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    segment.append(value);
+  }
+  auto matches = std::vector<ChunkOffset>{7};
+  scan_value_segment(segment, ScanType::OpGreaterThanEquals, 97, matches);
+  EXPECT_EQ(matches, (std::vector<ChunkOffset>{7, 97, 98, 99}));
+}
+
+TEST_F(OperatorsValueSegmentScanTest, DecodedValues) {
+  auto values = std::vector<int64_t>{};
+  for (auto value = int64_t{0}; value < 100; ++value) {
+    values.push_back(value % 10);
+  }
+  auto matches = std::vector<ChunkOffset>{3};
+  scan_decoded_values(std::span<const int64_t>{values}, ChunkOffset{128}, ScanType::OpEquals, int64_t{7}, matches);
+  auto expected = std::vector<ChunkOffset>{3};
+  for (auto index = ChunkOffset{7}; index < 100; index += 10) {
+    expected.push_back(128 + index);
+  }
+  EXPECT_EQ(matches, expected);
+}
+
+}  // namespace opossum
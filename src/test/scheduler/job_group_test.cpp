@@ -0,0 +1,68 @@
+#include <atomic>
+#include <stdexcept>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_group.hpp"
+#include "scheduler/task_scheduler.hpp"
+
+namespace opossum {
+
+class SchedulerJobGroupTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    TaskScheduler::get().reset();
+  }
+};
+
+TEST_F(SchedulerJobGroupTest, WaitWithoutJobs) {
+  auto jobs = JobGroup{};
+  jobs.wait();
+}
+
+TEST_F(SchedulerJobGroupTest, NestedGroups) {
+  // A single worker must not deadlock when its job waits for a nested group.
+  TaskScheduler::get().set_worker_count(1);
+
+  auto counter = std::atomic<size_t>{0};
+  auto jobs = JobGroup{};
+  for (auto outer = size_t{0}; outer < 8; ++outer) {
+    jobs.schedule([&] {
+      auto nested_jobs = JobGroup{};
+      for (auto inner = size_t{0}; inner < 8; ++inner) {
+        nested_jobs.schedule([&] { ++counter; });
+      }
+      nested_jobs.wait();
+    });
+  }
+  jobs.wait();
+  EXPECT_EQ(counter, 64);
+}
+
+TEST_F(SchedulerJobGroupTest, RethrowsException) {
+  for (const auto worker_count : {size_t{0}, size_t{2}}) {
+    TaskScheduler::get().set_worker_count(worker_count);
+
+    auto counter = std::atomic<size_t>{0};
+    auto jobs = JobGroup{};
+    jobs.schedule([&] { ++counter; });
+    jobs.schedule([] { throw std::logic_error("Job failed."); });
+    jobs.schedule([&] { ++counter; });
+    EXPECT_THROW(jobs.wait(), std::logic_error);
+    // The other jobs still ran, and the exception is only reported once.
+    EXPECT_EQ(counter, 2);
+    jobs.wait();
+  }
+}
+
+TEST_F(SchedulerJobGroupTest, Reusable) {
+  auto counter = std::atomic<size_t>{0};
+  auto jobs = JobGroup{};
+  jobs.schedule([&] { ++counter; });
+  jobs.wait();
+  jobs.schedule([&] { ++counter; });
+  jobs.wait();
+  EXPECT_EQ(counter, 2);
+}
+
+}  // namespace opossum
@@ -0,0 +1,93 @@
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_group.hpp"
+#include "scheduler/task_scheduler.hpp"
+
+namespace opossum {
+
+class SchedulerTaskSchedulerTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    TaskScheduler::get().reset();
+  }
+};
+
+TEST_F(SchedulerTaskSchedulerTest, DefaultWorkerCount) {
+  EXPECT_EQ(TaskScheduler::get().worker_count(), std::max(1u, std::thread::hardware_concurrency()));
+}
+
+TEST_F(SchedulerTaskSchedulerTest, ExecutesAllJobs) {
+  TaskScheduler::get().set_worker_count(4);
+  EXPECT_EQ(TaskScheduler::get().worker_count(), 4);
+
+  auto counter = std::atomic<size_t>{0};
+  auto jobs = JobGroup{};
+  for (auto index = size_t{0}; index < 10'000; ++index) {
+    jobs.schedule([&] { ++counter; });
+  }
+  jobs.wait();
+  EXPECT_EQ(counter, 10'000);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, RunsJobsOnBoundedNumberOfThreads) {
+  TaskScheduler::get().set_worker_count(2);
+
+  auto mutex = std::mutex{};
+  auto thread_ids = std::set<std::thread::id>{};
+  auto jobs = JobGroup{};
+  for (auto index = size_t{0}; index < 1'000; ++index) {
+    jobs.schedule([&] {
+      const auto lock = std::lock_guard{mutex};
+      thread_ids.insert(std::this_thread::get_id());
+    });
+  }
+  jobs.wait();
+
+  // Two workers plus the waiting thread, which helps executing jobs.
+  EXPECT_LE(thread_ids.size(), 3);
+}
+
+TEST_F(SchedulerTaskSchedulerTest, InlineExecution) {
+  TaskScheduler::get().set_worker_count(0);
+  EXPECT_EQ(TaskScheduler::get().worker_count(), 0);
+
+  const auto caller_id = std::this_thread::get_id();
+  auto order = std::vector<size_t>{};
+  auto jobs = JobGroup{};
+  for (auto index = size_t{0}; index < 5; ++index) {
+    jobs.schedule([&, index] {
+      EXPECT_EQ(std::this_thread::get_id(), caller_id);
+      order.push_back(index);
+    });
+    // Jobs have already run when schedule() returns.
+    EXPECT_EQ(order.size(), index + 1);
+  }
+  jobs.wait();
+  EXPECT_EQ(order, std::vector<size_t>({0, 1, 2, 3, 4}));
+}
+
+TEST_F(SchedulerTaskSchedulerTest, CompressesWideTable) {
+  TaskScheduler::get().set_worker_count(2);
+
+  auto table = Table{2};
+  for (auto column_id = size_t{0}; column_id < 200; ++column_id) {
+    table.add_column("column_" + std::to_string(column_id), "int", false);
+  }
+  for (auto row = int32_t{0}; row < 2; ++row) {
+    table.append(std::vector<AllTypeVariant>(200, row));
+  }
+  table.compress_chunk(ChunkID{0});
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  ASSERT_EQ(chunk->column_count(), 200);
+  for (auto column_id = ColumnID{0}; column_id < 200; ++column_id) {
+    EXPECT_EQ((*chunk->get_segment(column_id))[1], AllTypeVariant{1});
+  }
+}
+
+}  // namespace opossum
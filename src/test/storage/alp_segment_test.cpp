@@ -0,0 +1,99 @@
+#include <cmath>
+
+#include "base_test.hpp"
+
+#include "storage/alp_segment.hpp"
+
+namespace opossum {
+
+class StorageALPSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<double>> value_segment_double{std::make_shared<ValueSegment<double>>(true)};
+  std::shared_ptr<ValueSegment<float>> value_segment_float{std::make_shared<ValueSegment<float>>()};
+};
+
+TEST_F(StorageALPSegmentTest, CompressSegmentDouble) {
+  value_segment_double->append(21.37);
+  value_segment_double->append(-3.5);
+  value_segment_double->append(NULL_VALUE);
+  value_segment_double->append(1000.0);
+  value_segment_double->append(0.01);
+
+  const auto alp_segment = std::make_shared<ALPSegment<double>>(value_segment_double);
+  EXPECT_EQ(alp_segment->size(), 5);
+  EXPECT_EQ(alp_segment->block_count(), 1);
+  EXPECT_EQ(alp_segment->exception_count(), 0);
+
+  EXPECT_EQ(alp_segment->get(0), 21.37);
+  EXPECT_EQ(alp_segment->get(1), -3.5);
+  EXPECT_EQ(alp_segment->get(3), 1000.0);
+  EXPECT_EQ(alp_segment->get(4), 0.01);
+  EXPECT_EQ((*alp_segment)[0], AllTypeVariant{21.37});
+
+  EXPECT_TRUE(alp_segment->is_null(2));
+  EXPECT_TRUE(variant_is_null((*alp_segment)[2]));
+  EXPECT_EQ(alp_segment->get_typed_value(2), std::nullopt);
+  EXPECT_THROW(alp_segment->get(2), std::logic_error);
+  EXPECT_THROW(alp_segment->get(5), std::logic_error);
+}
+
+TEST_F(StorageALPSegmentTest, Exceptions) {
+  const auto values = std::vector<double>{1.5,
+                                          1.0 / 3.0,
+                                          std::numeric_limits<double>::quiet_NaN(),
+                                          std::numeric_limits<double>::infinity(),
+                                          -0.0,
+                                          1e300,
+                                          2.25};
+  for (const auto value : values) {
+    value_segment_double->append(value);
+  }
+
+  const auto alp_segment = std::make_shared<ALPSegment<double>>(value_segment_double);
+  EXPECT_EQ(alp_segment->exception_count(), 5);
+  EXPECT_EQ(alp_segment->get(0), 1.5);
+  EXPECT_EQ(alp_segment->get(1), 1.0 / 3.0);
+  EXPECT_TRUE(std::isnan(alp_segment->get(2)));
+  EXPECT_EQ(alp_segment->get(3), std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(std::signbit(alp_segment->get(4)));
+  EXPECT_EQ(alp_segment->get(5), 1e300);
+  EXPECT_EQ(alp_segment->get(6), 2.25);
+}
+
+TEST_F(StorageALPSegmentTest, DecodeBlocks) {
+  const auto block_size = ALPSegment<float>::BLOCK_SIZE;
+  const auto row_count = block_size * 2 + 100;
+  for (auto index = ChunkOffset{0}; index < row_count; ++index) {
+    // Every 100th value has too many decimals to be encoded.
+    const auto value = index % 100 == 0 ? static_cast<float>(index) / 7.0f : static_cast<float>(index % 500) / 4.0f;
+    value_segment_float->append(value);
+  }
+
+  const auto alp_segment = std::make_shared<ALPSegment<float>>(value_segment_float);
+  ASSERT_EQ(alp_segment->block_count(), 3);
+  EXPECT_GT(alp_segment->exception_count(), 0);
+
+  auto decoded = std::vector<float>(block_size);
+  for (auto block_index = size_t{0}; block_index < alp_segment->block_count(); ++block_index) {
+    alp_segment->decode_block(block_index, decoded.data());
+    const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+    const auto block_end = std::min(row_count, block_begin + block_size);
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      ASSERT_EQ(decoded[chunk_offset - block_begin], value_segment_float->get(chunk_offset));
+      ASSERT_EQ(alp_segment->get(chunk_offset), value_segment_float->get(chunk_offset));
+    }
+  }
+}
+
+TEST_F(StorageALPSegmentTest, MemoryUsage) {
+  // Sensor readings with two decimals between 15.00 and 35.00.
+  for (auto index = 0; index < 4096; ++index) {
+    value_segment_double->append(static_cast<double>(1500 + (index * 37) % 2000) / 100.0);
+  }
+
+  const auto alp_segment = std::make_shared<ALPSegment<double>>(value_segment_double);
+  EXPECT_EQ(alp_segment->exception_count(), 0);
+  EXPECT_LT(alp_segment->estimate_memory_usage() * 4, value_segment_double->estimate_memory_usage());
+}
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#include <numeric>
+#include "base_test.hpp"
+
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+
+namespace opossum {
+
+class BitPackedAttributeVectorTest : public BaseTest {
+ protected:
+  // Creates size value ids cycling through [0, max_value_id].
+  static std::vector<ValueID> create_value_ids(const size_t size, const uint32_t max_value_id) {
+    auto value_ids = std::vector<ValueID>(size);
+    for (auto index = size_t{0}; index < size; ++index) {
+      value_ids[index] = ValueID{static_cast<uint32_t>((index * 7) % (size_t{max_value_id} + 1))};
+    }
+    return value_ids;
+  }
+};
+
+TEST_F(BitPackedAttributeVectorTest, MinimalBitWidth) {
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{0}), 1);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{1}), 1);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{2}), 2);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{300}), 9);
+  EXPECT_EQ(BitPackedAttributeVector::required_bit_width(ValueID{std::numeric_limits<uint32_t>::max() - 1}), 32);
+
+  const auto attribute_vector = BitPackedAttributeVector{create_value_ids(100, 300)};
+  EXPECT_EQ(attribute_vector.bit_width(), 9);
+  EXPECT_EQ(attribute_vector.width(), 2);
+  EXPECT_EQ(attribute_vector.size(), 100);
+}
+
+TEST_F(BitPackedAttributeVectorTest, RoundTripAllBitWidths) {
+  for (auto bit_width = uint8_t{1}; bit_width <= 32; ++bit_width) {
+    const auto max_value_id = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    const auto value_ids = create_value_ids(1000, max_value_id);
+    const auto attribute_vector = BitPackedAttributeVector{value_ids, bit_width};
+
+    for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+      ASSERT_EQ(attribute_vector.get(index), value_ids[index]) << "bit width " << static_cast<int>(bit_width);
+    }
+
+    auto decoded = std::vector<ValueID>(value_ids.size() - 13);
+    attribute_vector.decode(13, decoded.size(), decoded.data());
+    EXPECT_TRUE(std::equal(decoded.begin(), decoded.end(), value_ids.begin() + 13));
+  }
+}
+
+TEST_F(BitPackedAttributeVectorTest, SetValue) {
+  auto attribute_vector = BitPackedAttributeVector{create_value_ids(200, 511)};
+  ASSERT_EQ(attribute_vector.bit_width(), 9);
+
+  // Position 7 starts at bit 63 and spans two words.
+  attribute_vector.set(7, ValueID{511});
+  attribute_vector.set(8, ValueID{0});
+  EXPECT_EQ(attribute_vector.get(6), ValueID{42});
+  EXPECT_EQ(attribute_vector.get(7), ValueID{511});
+  EXPECT_EQ(attribute_vector.get(8), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(9), ValueID{63});
+
+  EXPECT_THROW(attribute_vector.set(0, ValueID{512}), std::logic_error);
+  EXPECT_THROW(attribute_vector.set(200, ValueID{1}), std::logic_error);
+}
+
+TEST_F(BitPackedAttributeVectorTest, OutOfRange) {
+  const auto attribute_vector = BitPackedAttributeVector{create_value_ids(10, 3)};
+  EXPECT_THROW(attribute_vector.get(10), std::logic_error);
+
+  auto decoded = std::vector<ValueID>(5);
+  EXPECT_THROW(attribute_vector.decode(6, 5, decoded.data()), std::logic_error);
+  EXPECT_THROW((BitPackedAttributeVector{create_value_ids(10, 3), 1}), std::logic_error);
+  EXPECT_THROW((BitPackedAttributeVector{create_value_ids(10, 3), 33}), std::logic_error);
+}
+
+TEST_F(BitPackedAttributeVectorTest, MemoryUsage) {
+  // 1000 values * 9 bits = 9000 bits, which fit into 141 words.
+  const auto attribute_vector = BitPackedAttributeVector{create_value_ids(1000, 300)};
+  EXPECT_EQ(attribute_vector.estimate_memory_usage(), size_t{141 * 8});
+}
+
+TEST_F(BitPackedAttributeVectorTest, CompressChoosesBitPackingWhenSmaller) {
+  // 300 dictionary entries need 16 bits in a FixedWidthIntegerVector but only 9 bits when bit-packed.
+  const auto compressed = compress_attribute_vector(create_value_ids(1000, 300));
+  const auto bit_packed = std::dynamic_pointer_cast<BitPackedAttributeVector>(compressed);
+  ASSERT_TRUE(bit_packed);
+  EXPECT_EQ(bit_packed->bit_width(), 9);
+
+  // A full byte does not benefit from bit-packing.
+  const auto byte_aligned = compress_attribute_vector(create_value_ids(1000, 255));
+  EXPECT_TRUE(std::dynamic_pointer_cast<FixedWidthIntegerVector<uint8_t>>(byte_aligned));
+
+  // Few values do not benefit either, since the packed values are padded to a full word.
+  const auto few_values = compress_attribute_vector(create_value_ids(3, 1));
+  EXPECT_TRUE(std::dynamic_pointer_cast<FixedWidthIntegerVector<uint8_t>>(few_values));
+}
+
+}  // namespace opossum
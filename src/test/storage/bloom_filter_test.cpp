@@ -0,0 +1,42 @@
+#include "base_test.hpp"
+
+#include "storage/bloom_filter.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  auto bloom_filter = BloomFilter{1'000};
+  EXPECT_EQ(bloom_filter.block_count(), 20);
+  EXPECT_EQ(bloom_filter.estimate_memory_usage(), 20 * 64);
+
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    bloom_filter.insert(value_hash(value * 7));
+  }
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    EXPECT_TRUE(bloom_filter.may_contain(value_hash(value * 7)));
+  }
+}
+
+TEST_F(StorageBloomFilterTest, FewFalsePositives) {
+  auto bloom_filter = BloomFilter{10'000};
+  for (auto value = int64_t{0}; value < 10'000; ++value) {
+    bloom_filter.insert(value_hash(value));
+  }
+
+  auto false_positive_count = size_t{0};
+  for (auto value = int64_t{10'000}; value < 110'000; ++value) {
+    false_positive_count += bloom_filter.may_contain(value_hash(value));
+  }
+  // The expected rate at ten bits per value is about one percent.
+  EXPECT_LT(false_positive_count, 3'000);
+}
+
+TEST_F(StorageBloomFilterTest, EmptyFilter) {
+  const auto bloom_filter = BloomFilter{0};
+  EXPECT_EQ(bloom_filter.block_count(), 1);
+  EXPECT_FALSE(bloom_filter.may_contain(value_hash(std::string{"a"})));
+}
+
+}  // namespace opossum
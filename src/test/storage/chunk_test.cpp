@@ -4,6 +4,7 @@
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key_index.hpp"
 
 namespace opossum {
 
@@ -124,4 +125,20 @@ TEST_F(StorageChunkTest, AppendToNonValueSegment) {
   EXPECT_THROW(chunk.append({0}), std::logic_error);
 }
 
+TEST_F(StorageChunkTest, CreateAndRemoveIndex) {
+  chunk.add_segment(std::make_shared<DictionarySegment<int32_t>>(int_value_segment));
+  chunk.add_segment(std::make_shared<DictionarySegment<std::string>>(string_value_segment));
+  EXPECT_TRUE(chunk.get_indexes({ColumnID{0}}).empty());
+
+  const auto index = chunk.create_index<GroupKeyIndex>({ColumnID{1}});
+  EXPECT_TRUE(chunk.get_indexes({ColumnID{0}}).empty());
+  const auto indexes = chunk.get_indexes({ColumnID{1}});
+  ASSERT_EQ(indexes.size(), 1);
+  EXPECT_EQ(indexes.front(), index);
+
+  chunk.remove_index(index);
+  EXPECT_TRUE(chunk.get_indexes({ColumnID{1}}).empty());
+  EXPECT_THROW(chunk.remove_index(index), std::logic_error);
+}
+
 }  // namespace opossum
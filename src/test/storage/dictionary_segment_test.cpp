@@ -69,6 +69,76 @@ TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   EXPECT_EQ(dict_segment->upper_bound(15), INVALID_VALUE_ID);
 }
 
+TEST_F(StorageDictionarySegmentTest, StoresNaNBehindOrderedValues) {
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto value_segment = std::make_shared<ValueSegment<float>>(true);
+  for (const auto& value : {AllTypeVariant{3.0f}, AllTypeVariant{nan}, AllTypeVariant{1.0f}, AllTypeVariant{nan},
+                            NULL_VALUE, AllTypeVariant{5.0f}, AllTypeVariant{2.0f}, AllTypeVariant{nan},
+                            AllTypeVariant{4.0f}}) {
+    value_segment->append(value);
+  }
+
+  // ValueSegments take the typed path, other segments are read value by value. Both keep a single NaN entry last.
+  const auto typed_segment = std::make_shared<DictionarySegment<float>>(value_segment);
+  const auto generic_segment = std::make_shared<DictionarySegment<float>>(typed_segment);
+  for (const auto& dict_segment : {typed_segment, generic_segment}) {
+    const auto& dict = dict_segment->dictionary();
+    ASSERT_EQ(dict.size(), 6);
+    EXPECT_EQ(std::vector<float>(dict.begin(), dict.end() - 1), (std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f}));
+    EXPECT_TRUE(std::isnan(dict.back()));
+    EXPECT_EQ(dict_segment->nan_value_id(), ValueID{5});
+
+    // NaN is not ordered against the other values, so the bounds never refer to it.
+    EXPECT_EQ(dict_segment->lower_bound(4.0f), ValueID{3});
+    EXPECT_EQ(dict_segment->upper_bound(4.0f), ValueID{4});
+    EXPECT_EQ(dict_segment->upper_bound(5.0f), INVALID_VALUE_ID);
+    EXPECT_EQ(dict_segment->lower_bound(nan), INVALID_VALUE_ID);
+    EXPECT_EQ(dict_segment->upper_bound(nan), INVALID_VALUE_ID);
+
+    for (const auto chunk_offset : {ChunkOffset{1}, ChunkOffset{3}, ChunkOffset{7}}) {
+      EXPECT_EQ(dict_segment->attribute_vector()->get(chunk_offset), ValueID{5});
+      EXPECT_TRUE(std::isnan(dict_segment->get(chunk_offset)));
+    }
+    EXPECT_EQ(dict_segment->get(ChunkOffset{8}), 4.0f);
+    EXPECT_FALSE(dict_segment->get_typed_value(ChunkOffset{4}));
+  }
+
+  const auto segment_without_nan = std::make_shared<DictionarySegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(segment_without_nan->nan_value_id(), INVALID_VALUE_ID);
+}
+
+TEST_F(StorageDictionarySegmentTest, TypedAndGenericConstructionMatch) {
+  for (auto index = int32_t{0}; index < 1'000; ++index) {
+    value_segment_str->append(index % 7 == 0 ? NULL_VALUE : AllTypeVariant{std::to_string((index * 37) % 101)});
+  }
+
+  // ValueSegments take the typed path, other segments are read value by value.
+  const auto typed_segment = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
+  const auto generic_segment = std::make_shared<DictionarySegment<std::string>>(typed_segment);
+
+  ASSERT_EQ(typed_segment->unique_values_count(), generic_segment->unique_values_count());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < value_segment_str->size(); ++chunk_offset) {
+    EXPECT_EQ(typed_segment->attribute_vector()->get(chunk_offset),
+              generic_segment->attribute_vector()->get(chunk_offset));
+    EXPECT_EQ(typed_segment->get_typed_value(chunk_offset), value_segment_str->get_typed_value(chunk_offset));
+  }
+}
+
+TEST_F(StorageDictionarySegmentTest, CompressLargeSegment) {
+  // Large enough to be sorted in parallel on machines with several cores.
+  const auto row_count = int32_t{1'000'000};
+  for (auto index = int32_t{0}; index < row_count; ++index) {
+    value_segment_int->append(static_cast<int32_t>((int64_t{index} * 7'919) % 65'536) - 1'000);
+  }
+
+  const auto dict_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(dict_segment->unique_values_count(), 65'536);
+  EXPECT_EQ(dict_segment->value_of_value_id(ValueID{0}), -1'000);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(row_count); chunk_offset += 997) {
+    EXPECT_EQ(dict_segment->get(chunk_offset), value_segment_int->get(chunk_offset));
+  }
+}
+
 TEST_F(StorageDictionarySegmentTest, CompressEmptySegment) {
   const auto dict_segment = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
   EXPECT_EQ(dict_segment->size(), 0);
@@ -0,0 +1,138 @@
+#include "base_test.hpp"
+
+#include "storage/alp_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class StorageEncodingAdvisorTest : public BaseTest {
+ protected:
+  ValueSegment<int32_t> value_segment_int{true};
+  ValueSegment<std::string> value_segment_str{};
+  ValueSegment<double> value_segment_double{};
+};
+
+TEST_F(StorageEncodingAdvisorTest, ProfileSegment) {
+  for (auto index = int32_t{0}; index < 10'000; ++index) {
+    if (index % 10 == 0) {
+      value_segment_int.append(NULL_VALUE);
+    } else {
+      value_segment_int.append(index / 100);
+    }
+  }
+
+  const auto advisor = EncodingAdvisor<int32_t>{value_segment_int};
+  const auto& profile = advisor.profile();
+  EXPECT_EQ(profile.row_count, 10'000);
+  EXPECT_EQ(profile.sample_size, EncodingAdvisor<int32_t>::SAMPLE_WINDOW_COUNT *
+                                     EncodingAdvisor<int32_t>::SAMPLE_WINDOW_SIZE);
+  EXPECT_NEAR(profile.null_count, 1'000, 100);
+  EXPECT_TRUE(profile.is_sorted);
+  EXPECT_EQ(profile.value_range_bit_width, 7);
+  // Every value repeats 90 times, so all distinct values of the sample are seen more than once.
+  EXPECT_GE(profile.distinct_count, 16);
+  EXPECT_LE(profile.distinct_count, 100);
+}
+
+TEST_F(StorageEncodingAdvisorTest, ChooseEncoding) {
+  // Long runs of a few values favor run-length encoding.
+  for (auto index = int32_t{0}; index < 10'000; ++index) {
+    value_segment_int.append(index / 2'500);
+  }
+  EXPECT_EQ(EncodingAdvisor<int32_t>{value_segment_int}.recommended_encoding(), EncodingType::RunLength);
+
+  // Unique, dense keys favor frame-of-reference encoding.
+  auto keys = ValueSegment<int32_t>{};
+  for (auto index = int32_t{0}; index < 10'000; ++index) {
+    keys.append(1'000'000 + (index * 7'919) % 10'000);
+  }
+  EXPECT_EQ(EncodingAdvisor<int32_t>{keys}.recommended_encoding(), EncodingType::FrameOfReference);
+
+  // A few distinct strings in random order favor dictionary encoding.
+  for (auto index = 0; index < 10'000; ++index) {
+    value_segment_str.append(std::vector<std::string>{"red", "green", "blue"}[(index * 7) % 3]);
+  }
+  EXPECT_EQ(EncodingAdvisor<std::string>{value_segment_str}.recommended_encoding(), EncodingType::Dictionary);
+
+  // Unique free text favors FSST.
+  auto texts = ValueSegment<std::string>{};
+  for (auto index = 0; index < 5'000; ++index) {
+    texts.append("Order " + std::to_string(index) + " was shipped to the customer on time");
+  }
+  EXPECT_EQ(EncodingAdvisor<std::string>{texts}.recommended_encoding(), EncodingType::FSST);
+
+  // Measurements with two decimals favor ALP.
+  for (auto index = 0; index < 10'000; ++index) {
+    value_segment_double.append(static_cast<double>((index * 7'919) % 100'000) / 100.0);
+  }
+  const auto advisor = EncodingAdvisor<double>{value_segment_double};
+  EXPECT_EQ(advisor.recommended_encoding(), EncodingType::ALP);
+  EXPECT_EQ(advisor.estimates().size(), 3);
+  EXPECT_LE(advisor.estimates()[0].memory_usage, advisor.estimates()[1].memory_usage);
+}
+
+TEST_F(StorageEncodingAdvisorTest, EmptySegment) {
+  const auto advisor = EncodingAdvisor<std::string>{value_segment_str};
+  EXPECT_EQ(advisor.profile().row_count, 0);
+  EXPECT_EQ(advisor.recommended_encoding(), EncodingType::Dictionary);
+}
+
+TEST_F(StorageEncodingAdvisorTest, CompressChunkWithAdvisor) {
+  auto table = Table{10'000};
+  table.add_column("id", "int", false);
+  table.add_column("status", "string", false);
+  table.add_column("price", "double", false);
+  for (auto index = int32_t{0}; index < 10'000; ++index) {
+    const auto price = static_cast<double>((index * 7'919) % 100'000) / 100.0;
+    table.append({index, index < 5'000 ? "open" : "closed", price});
+  }
+
+  const auto decisions = table.compress_chunk(ChunkID{0});
+  ASSERT_EQ(decisions.size(), 3);
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_EQ(decisions[0].encoding_type, EncodingType::FrameOfReference);
+  EXPECT_TRUE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_EQ(decisions[1].encoding_type, EncodingType::RunLength);
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<std::string>>(chunk->get_segment(ColumnID{1})));
+  EXPECT_EQ(decisions[2].encoding_type, EncodingType::ALP);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ALPSegment<double>>(chunk->get_segment(ColumnID{2})));
+
+  for (const auto& decision : decisions) {
+    EXPECT_FALSE(decision.is_forced);
+    EXPECT_LT(decision.memory_usage, decision.uncompressed_memory_usage);
+  }
+  EXPECT_EQ(decisions[0].memory_usage, chunk->get_segment(ColumnID{0})->estimate_memory_usage());
+}
+
+TEST_F(StorageEncodingAdvisorTest, ForceColumnEncoding) {
+  auto table = Table{2};
+  table.add_column("id", "int", false);
+  table.add_column("name", "string", false);
+  table.set_column_encoding(ColumnID{0}, EncodingType::Dictionary);
+  table.set_column_encoding(ColumnID{1}, EncodingType::FrameOfReference);
+  EXPECT_EQ(table.column_encoding(ColumnID{0}), EncodingType::Dictionary);
+  EXPECT_THROW(table.set_column_encoding(ColumnID{2}, EncodingType::Dictionary), std::logic_error);
+
+  table.append({1, "Alice"});
+  table.append({2, "Bob"});
+  const auto decisions = table.compress_chunk(ChunkID{0});
+  EXPECT_TRUE(decisions[0].is_forced);
+  EXPECT_EQ(decisions[0].encoding_type, EncodingType::Dictionary);
+  // Frame-of-reference encoding is not defined for strings.
+  EXPECT_EQ(decisions[1].encoding_type, EncodingType::Dictionary);
+
+  // An encoding passed to compress_chunk takes precedence over the column overrides.
+  table.set_column_encoding(ColumnID{1}, std::nullopt);
+  EXPECT_EQ(table.column_encoding(ColumnID{1}), std::nullopt);
+  table.append({3, "Carol"});
+  const auto forced_decisions = table.compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  EXPECT_EQ(forced_decisions[0].encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(forced_decisions[1].encoding_type, EncodingType::RunLength);
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include "base_test.hpp"
+
+#include "storage/equi_depth_histogram.hpp"
+
+namespace opossum {
+
+class StorageEquiDepthHistogramTest : public BaseTest {};
+
+TEST_F(StorageEquiDepthHistogramTest, FromSortedValues) {
+  const auto histogram = EquiDepthHistogram<int32_t>::from_sorted_values({1, 2, 2, 2, 3, 4, 5, 5, 9}, 3);
+  const auto& bins = histogram.bins();
+  ASSERT_EQ(bins.size(), 3);
+  // All occurrences of 2 end up in the first bin.
+  EXPECT_EQ(bins[0].min, 1);
+  EXPECT_EQ(bins[0].max, 2);
+  EXPECT_EQ(bins[0].height, 4);
+  EXPECT_EQ(bins[0].distinct_count, 2);
+  EXPECT_EQ(bins[1].min, 3);
+  EXPECT_EQ(bins[1].max, 5);
+  EXPECT_EQ(bins[1].height, 4);
+  EXPECT_EQ(bins[2].min, 9);
+  EXPECT_EQ(histogram.total_count(), 9);
+
+  EXPECT_TRUE(EquiDepthHistogram<int32_t>::from_sorted_values({}, 3).bins().empty());
+  EXPECT_THROW(EquiDepthHistogram<int32_t>::from_sorted_values({1}, 0), std::logic_error);
+}
+
+TEST_F(StorageEquiDepthHistogramTest, EstimateCount) {
+  auto values = std::vector<int32_t>{};
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    values.push_back(value);
+  }
+  const auto histogram = EquiDepthHistogram<int32_t>::from_sorted_values(values, 10);
+
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpEquals, 42), 1.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpEquals, 100), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpNotEquals, 42), 99.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpLessThan, 42), 42.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpLessThanEquals, 42), 43.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpGreaterThan, 42), 57.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpGreaterThanEquals, 42), 58.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpLessThan, -5), 0.0);
+  EXPECT_DOUBLE_EQ(histogram.estimate_count(ScanType::OpGreaterThan, 99), 0.0);
+}
+
+TEST_F(StorageEquiDepthHistogramTest, EstimateCountStringsAndFloats) {
+  const auto string_histogram = EquiDepthHistogram<std::string>::from_sorted_values({"a", "b", "c", "d"}, 1);
+  EXPECT_DOUBLE_EQ(string_histogram.estimate_count(ScanType::OpEquals, "b"), 1.0);
+  EXPECT_DOUBLE_EQ(string_histogram.estimate_count(ScanType::OpEquals, "e"), 0.0);
+  EXPECT_DOUBLE_EQ(string_histogram.estimate_count(ScanType::OpLessThan, "c"), 2.0);
+  EXPECT_DOUBLE_EQ(string_histogram.estimate_count(ScanType::OpGreaterThanEquals, "a"), 4.0);
+
+  const auto float_histogram = EquiDepthHistogram<float>::from_sorted_values({0.0f, 1.0f, 2.0f, 4.0f}, 1);
+  EXPECT_DOUBLE_EQ(float_histogram.estimate_count(ScanType::OpLessThan, 1.0f), 1.0);
+  EXPECT_DOUBLE_EQ(float_histogram.estimate_count(ScanType::OpEquals, std::numeric_limits<float>::quiet_NaN()), 0.0);
+  EXPECT_DOUBLE_EQ(float_histogram.estimate_count(ScanType::OpNotEquals, std::numeric_limits<float>::quiet_NaN()),
+                   4.0);
+}
+
+TEST_F(StorageEquiDepthHistogramTest, Merge) {
+  const auto lhs = EquiDepthHistogram<int32_t>::from_sorted_values({1, 2, 3, 4, 5, 6, 7, 8}, 4);
+  const auto rhs = EquiDepthHistogram<int32_t>::from_sorted_values({5, 6, 7, 8, 9, 10, 11, 12}, 4);
+  auto merged = EquiDepthHistogram<int32_t>::merge(lhs, rhs, 4);
+  ASSERT_LE(merged.bins().size(), 4);
+  EXPECT_DOUBLE_EQ(merged.total_count(), 16.0);
+  EXPECT_EQ(merged.bins().front().min, 1);
+  EXPECT_EQ(merged.bins().back().max, 12);
+  EXPECT_DOUBLE_EQ(merged.estimate_count(ScanType::OpLessThan, 100), 16.0);
+
+  // Values 5 to 8 occur in both histograms, so there are 12 instead of 16 distinct values.
+  merged.scale_distinct_counts(12.0);
+  auto distinct_count = 0.0;
+  for (const auto& bin : merged.bins()) {
+    distinct_count += bin.distinct_count;
+  }
+  EXPECT_NEAR(distinct_count, 12.0, 1e-9);
+}
+
+}  // namespace opossum
@@ -37,4 +37,49 @@ TEST_F(FixedWidthIntegerVectorTest, SetValue) {
   EXPECT_EQ(fixed_width_integer_vector->get(0), 1);
 }
 
+TEST_F(FixedWidthIntegerVectorTest, DecodeRange) {
+  const auto test_decode = []<typename T>() {
+    // Odd sizes and offsets make sure that the SIMD kernels and their scalar tails are both exercised.
+    auto value_ids = std::vector<ValueID>(1001);
+    for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+      value_ids[index] = ValueID{static_cast<uint32_t>((index * 31) % std::numeric_limits<T>::max())};
+    }
+    const auto attribute_vector = FixedWidthIntegerVector<T>{value_ids};
+
+    auto decoded = std::vector<ValueID>(value_ids.size() - 3);
+    attribute_vector.decode(3, decoded.size(), decoded.data());
+    EXPECT_TRUE(std::equal(decoded.begin(), decoded.end(), value_ids.begin() + 3));
+
+    EXPECT_THROW(attribute_vector.decode(3, value_ids.size(), decoded.data()), std::logic_error);
+  };  // NOLINT (because of the ;)
+  test_decode.operator()<uint8_t>();
+  test_decode.operator()<uint16_t>();
+  test_decode.operator()<uint32_t>();
+}
+
+TEST_F(FixedWidthIntegerVectorTest, ForEachBlock) {
+  const auto block_size = AbstractAttributeVector::DECODE_BLOCK_SIZE;
+  auto value_ids = std::vector<ValueID>(block_size * 2 + 5);
+  for (auto index = size_t{0}; index < value_ids.size(); ++index) {
+    value_ids[index] = ValueID{static_cast<uint32_t>(index % 200)};
+  }
+  const auto attribute_vector = compress_attribute_vector(value_ids);
+
+  auto visited = std::vector<ValueID>{};
+  auto block_begins = std::vector<size_t>{};
+  attribute_vector->for_each_block([&](const size_t first_index, const std::span<const ValueID> block) {
+    block_begins.push_back(first_index);
+    visited.insert(visited.end(), block.begin(), block.end());
+  });
+  EXPECT_EQ(block_begins, std::vector<size_t>({0, block_size, 2 * block_size}));
+  EXPECT_EQ(visited, value_ids);
+
+  visited.clear();
+  attribute_vector->for_each_block(10, 20, [&](const size_t first_index, const std::span<const ValueID> block) {
+    EXPECT_EQ(first_index, 10);
+    visited.insert(visited.end(), block.begin(), block.end());
+  });
+  EXPECT_EQ(visited, std::vector<ValueID>(value_ids.begin() + 10, value_ids.begin() + 20));
+}
+
 }  // namespace opossum
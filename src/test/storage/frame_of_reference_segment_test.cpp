@@ -0,0 +1,84 @@
+#include "base_test.hpp"
+
+#include "storage/frame_of_reference_segment.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<ValueSegment<int64_t>> value_segment_long{std::make_shared<ValueSegment<int64_t>>()};
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentInt) {
+  value_segment_int->append(1000);
+  value_segment_int->append(1003);
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(1001);
+
+  const auto for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(for_segment->size(), 4);
+  EXPECT_EQ(for_segment->block_count(), 1);
+  EXPECT_EQ(for_segment->block_minimums(), std::vector<int32_t>({1000}));
+
+  EXPECT_EQ(for_segment->get(0), 1000);
+  EXPECT_EQ(for_segment->get(1), 1003);
+  EXPECT_EQ(for_segment->get(3), 1001);
+  EXPECT_EQ((*for_segment)[3], AllTypeVariant{1001});
+
+  EXPECT_TRUE(for_segment->is_null(2));
+  EXPECT_TRUE(variant_is_null((*for_segment)[2]));
+  EXPECT_EQ(for_segment->get_typed_value(2), std::nullopt);
+  EXPECT_THROW(for_segment->get(2), std::logic_error);
+  EXPECT_THROW(for_segment->get(4), std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MultipleBlocks) {
+  const auto block_size = FrameOfReferenceSegment<int64_t>::BLOCK_SIZE;
+  const auto row_count = static_cast<int64_t>(block_size) * 2 + 17;
+  for (auto index = int64_t{0}; index < row_count; ++index) {
+    // The second block has a much larger base than the others.
+    const auto base = index / block_size == 1 ? int64_t{1} << 40 : int64_t{-5};
+    value_segment_long->append(base + (index * 13) % 100);
+  }
+
+  const auto for_segment = std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment_long);
+  ASSERT_EQ(for_segment->block_count(), 3);
+  EXPECT_EQ(for_segment->block_minimums()[0], -5);
+  EXPECT_EQ(for_segment->block_minimums()[1], int64_t{1} << 40);
+
+  auto decoded = std::vector<int64_t>(block_size);
+  for (auto block_index = size_t{0}; block_index < for_segment->block_count(); ++block_index) {
+    for_segment->decode_block(block_index, decoded.data());
+    const auto block_begin = static_cast<ChunkOffset>(block_index * block_size);
+    const auto block_end = std::min(static_cast<ChunkOffset>(row_count), block_begin + block_size);
+    for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+      ASSERT_EQ(decoded[chunk_offset - block_begin], value_segment_long->get(chunk_offset));
+      ASSERT_EQ(for_segment->get(chunk_offset), value_segment_long->get(chunk_offset));
+    }
+  }
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, ExtremeValues) {
+  value_segment_int->append(std::numeric_limits<int32_t>::min());
+  value_segment_int->append(std::numeric_limits<int32_t>::max());
+  value_segment_int->append(0);
+
+  const auto for_segment = std::make_shared<FrameOfReferenceSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(for_segment->get(0), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(for_segment->get(1), std::numeric_limits<int32_t>::max());
+  EXPECT_EQ(for_segment->get(2), 0);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, MemoryUsage) {
+  for (auto index = int64_t{0}; index < 2048; ++index) {
+    value_segment_long->append(int64_t{1'000'000'000'000} + index);
+  }
+
+  const auto for_segment = std::make_shared<FrameOfReferenceSegment<int64_t>>(value_segment_long);
+  // 2048 offsets of 11 bits each (352 words) + 8 bytes minimum + 1 byte bit width + 8 bytes word offset.
+  EXPECT_EQ(for_segment->estimate_memory_usage(), size_t{352 * 8 + 8 + 1 + 8});
+  EXPECT_LT(for_segment->estimate_memory_usage() * 4, value_segment_long->estimate_memory_usage());
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#include "base_test.hpp"
+
+#include "storage/fsst_segment.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str{std::make_shared<ValueSegment<std::string>>(true)};
+};
+
+TEST_F(StorageFSSTSegmentTest, CompressSegmentString) {
+  value_segment_str->append("https://example.com/products/1");
+  value_segment_str->append("");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("https://example.com/about");
+  // Contains the escape code and bytes that never occur elsewhere.
+  value_segment_str->append(std::string{"\xFF\x00\x01zz", 5});
+
+  const auto fsst_segment = std::make_shared<FSSTSegment<std::string>>(value_segment_str);
+  EXPECT_EQ(fsst_segment->size(), 5);
+  EXPECT_GT(fsst_segment->symbol_count(), 0);
+
+  EXPECT_EQ(fsst_segment->get(0), "https://example.com/products/1");
+  EXPECT_EQ(fsst_segment->get(1), "");
+  EXPECT_EQ(fsst_segment->get(3), "https://example.com/about");
+  EXPECT_EQ(fsst_segment->get(4), std::string("\xFF\x00\x01zz", 5));
+  EXPECT_EQ((*fsst_segment)[3], AllTypeVariant{"https://example.com/about"});
+
+  EXPECT_TRUE(fsst_segment->is_null(2));
+  EXPECT_TRUE(variant_is_null((*fsst_segment)[2]));
+  EXPECT_EQ(fsst_segment->get_typed_value(2), std::nullopt);
+  EXPECT_THROW(fsst_segment->get(2), std::logic_error);
+  EXPECT_THROW(fsst_segment->get(5), std::logic_error);
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressedEquality) {
+  for (auto index = 0; index < 1000; ++index) {
+    value_segment_str->append("The quick brown fox jumps over the lazy dog " + std::to_string(index % 37));
+  }
+
+  const auto fsst_segment = std::make_shared<FSSTSegment<std::string>>(value_segment_str);
+  const auto search_value = fsst_segment->compress("The quick brown fox jumps over the lazy dog 12");
+  EXPECT_LT(search_value.size(), std::string_view{"The quick brown fox jumps over the lazy dog 12"}.size());
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < fsst_segment->size(); ++chunk_offset) {
+    EXPECT_EQ(fsst_segment->compressed_value(chunk_offset) == search_value, chunk_offset % 37 == 12);
+    EXPECT_EQ(fsst_segment->get(chunk_offset), value_segment_str->get(chunk_offset));
+  }
+
+  // Values not present in the segment can be compressed as well, but never match.
+  const auto missing_value = fsst_segment->compress("The quick brown fox jumps over the lazy cat");
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < fsst_segment->size(); ++chunk_offset) {
+    EXPECT_NE(fsst_segment->compressed_value(chunk_offset), missing_value);
+  }
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressEmptySegment) {
+  const auto fsst_segment = std::make_shared<FSSTSegment<std::string>>(value_segment_str);
+  EXPECT_EQ(fsst_segment->size(), 0);
+  EXPECT_EQ(fsst_segment->symbol_count(), 0);
+}
+
+TEST_F(StorageFSSTSegmentTest, MemoryUsage) {
+  auto raw_size = size_t{0};
+  for (auto index = 0; index < 2000; ++index) {
+    const auto value = "Customer " + std::to_string(index) + " ordered product " + std::to_string(index * 7 % 113);
+    raw_size += value.size();
+    value_segment_str->append(value);
+  }
+
+  const auto fsst_segment = std::make_shared<FSSTSegment<std::string>>(value_segment_str);
+  EXPECT_LT(fsst_segment->estimate_memory_usage() * 2, raw_size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include "base_test.hpp"
+
+#include "storage/hyper_log_log.hpp"
+
+namespace opossum {
+
+class StorageHyperLogLogTest : public BaseTest {};
+
+TEST_F(StorageHyperLogLogTest, EstimateDistinctCount) {
+  auto hyper_log_log = HyperLogLog{};
+  EXPECT_EQ(hyper_log_log.estimate(), 0);
+  EXPECT_EQ(hyper_log_log.estimate_memory_usage(), 1'024);
+
+  // Duplicates do not change the estimate.
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      hyper_log_log.insert(value_hash(value));
+    }
+  }
+  EXPECT_NEAR(hyper_log_log.estimate(), 100, 5);
+
+  for (auto value = int64_t{0}; value < 100'000; ++value) {
+    hyper_log_log.insert(value_hash(value));
+  }
+  EXPECT_NEAR(hyper_log_log.estimate(), 100'000, 10'000);
+}
+
+TEST_F(StorageHyperLogLogTest, Merge) {
+  auto lhs = HyperLogLog{};
+  auto rhs = HyperLogLog{};
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    lhs.insert(value_hash(value));
+    rhs.insert(value_hash(value + 5'000));
+  }
+  lhs.merge(rhs);
+  EXPECT_NEAR(lhs.estimate(), 15'000, 1'500);
+
+  EXPECT_THROW(lhs.merge(HyperLogLog{12}), std::logic_error);
+  EXPECT_THROW(HyperLogLog{2}, std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,149 @@
+#include <random>
+
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/adaptive_radix_tree_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  template <typename T>
+  void expect_keys_ordered(const std::vector<T>& sorted_values) {
+    for (auto index = size_t{1}; index < sorted_values.size(); ++index) {
+      EXPECT_LT(encode_art_key(sorted_values[index - 1]), encode_art_key(sorted_values[index]));
+    }
+  }
+
+  // Compares lower_bound and upper_bound of the index with the values of the segment they point to.
+  template <typename T>
+  void expect_bounds(const BaseIndex& index, const ValueSegment<T>& segment, const std::vector<T>& search_values) {
+    for (const auto& search_value : search_values) {
+      const auto lower = index.lower_bound({search_value});
+      const auto upper = index.upper_bound({search_value});
+      for (auto iterator = index.cbegin(); iterator != lower; ++iterator) {
+        EXPECT_LT(segment.values()[*iterator], search_value);
+      }
+      for (auto iterator = lower; iterator != upper; ++iterator) {
+        EXPECT_EQ(segment.values()[*iterator], search_value);
+      }
+      for (auto iterator = upper; iterator != index.cend(); ++iterator) {
+        EXPECT_GT(segment.values()[*iterator], search_value);
+      }
+    }
+  }
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, KeysPreserveOrder) {
+  expect_keys_ordered<int32_t>({std::numeric_limits<int32_t>::min(), -256, -1, 0, 1, 255, 256,
+                                std::numeric_limits<int32_t>::max()});
+  expect_keys_ordered<int64_t>({std::numeric_limits<int64_t>::min(), -1, 0, int64_t{1} << 40});
+  expect_keys_ordered<float>({-std::numeric_limits<float>::infinity(), -2.5f, -1.0f, -0.0001f, 0.0f, 0.0001f, 1.0f,
+                              2.5f, std::numeric_limits<float>::infinity()});
+  expect_keys_ordered<double>({-1e300, -1.0, 0.0, 1e-300, 1.0, 1e300});
+  expect_keys_ordered<std::string>({"", std::string{"\0", 1}, std::string{"\0\0", 2}, "\x01", "a",
+                                    std::string{"a\0", 2}, "aa", "ab", "b", "\xFF"});
+
+  EXPECT_EQ(encode_art_key(-0.0), encode_art_key(0.0));
+  EXPECT_EQ(encode_art_key(int32_t{1}), (ARTKey{0x80, 0x00, 0x00, 0x01}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, ValueSegmentWithNulls) {
+  const auto segment = std::make_shared<ValueSegment<std::string>>(true);
+  for (const auto& value : {AllTypeVariant{"hotel"}, AllTypeVariant{"delta"}, NULL_VALUE, AllTypeVariant{"delta"},
+                            AllTypeVariant{"apple"}, AllTypeVariant{"apples"}, AllTypeVariant{"app"}}) {
+    segment->append(value);
+  }
+  const auto index = AdaptiveRadixTreeIndex{{segment}};
+  EXPECT_EQ(index.type(), SegmentIndexType::AdaptiveRadixTree);
+  EXPECT_TRUE(index.is_index_for({segment}));
+
+  EXPECT_EQ(std::vector<ChunkOffset>(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{6, 4, 5, 1, 3, 0}));
+  EXPECT_EQ(std::vector<ChunkOffset>(index.null_cbegin(), index.null_cend()), (std::vector<ChunkOffset>{2}));
+
+  const auto delta = std::vector<AllTypeVariant>{"delta"};
+  EXPECT_EQ(std::vector<ChunkOffset>(index.lower_bound(delta), index.upper_bound(delta)),
+            (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(index.lower_bound({"apple"}) - index.cbegin(), 1);
+  EXPECT_EQ(index.upper_bound({"apple"}) - index.cbegin(), 2);
+  EXPECT_EQ(index.lower_bound({"b"}) - index.cbegin(), 3);
+  EXPECT_EQ(index.lower_bound({"a"}), index.cbegin());
+  EXPECT_EQ(index.lower_bound({"zulu"}), index.cend());
+  EXPECT_EQ(index.upper_bound({"hotel"}), index.cend());
+
+  expect_bounds<std::string>(index, *segment, {"", "a", "app", "apple", "applesauce", "d", "delta", "hotel", "z"});
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, AllNodeTypes) {
+  // Random values spread over the whole domain create wide nodes near the root and narrow ones below.
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int32_t>{-100'000, 100'000};
+  const auto segment = std::make_shared<ValueSegment<int32_t>>();
+  auto search_values = std::vector<int32_t>{std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()};
+  for (auto index = 0; index < 5'000; ++index) {
+    const auto value = distribution(generator);
+    segment->append(value);
+    search_values.push_back(value);
+    search_values.push_back(distribution(generator));
+  }
+  // Ranges of small values create nodes with 4, 16, 48, and 256 children.
+  for (const auto fan_out : {3, 12, 40, 200}) {
+    for (auto value = int32_t{0}; value < fan_out; ++value) {
+      segment->append(1'000'000 * fan_out + value);
+    }
+  }
+
+  const auto index = AdaptiveRadixTreeIndex{{segment}};
+  EXPECT_EQ(index.cend() - index.cbegin(), segment->size());
+  EXPECT_GT(index.estimate_memory_usage(), segment->size() * sizeof(ChunkOffset));
+  expect_bounds<int32_t>(index, *segment, search_values);
+  expect_bounds<int32_t>(index, *segment, {3'000'001, 12'000'011, 40'000'020, 200'000'199, 200'000'200});
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, FloatsAndDictionarySegments) {
+  const auto segment = std::make_shared<ValueSegment<double>>();
+  for (const auto value : {2.5, -0.0, -7.25, 1e10, 0.0, -1e-10, 2.5}) {
+    segment->append(value);
+  }
+  const auto index = AdaptiveRadixTreeIndex{{segment}};
+  expect_bounds<double>(index, *segment, {-10.0, -7.25, -1.0, 0.0, -0.0, 1.0, 2.5, 1e10, 1e11});
+  EXPECT_EQ(index.upper_bound({0.0}) - index.lower_bound({-0.0}), 2);
+
+  const auto dictionary_segment = std::make_shared<DictionarySegment<double>>(segment);
+  const auto dictionary_index = AdaptiveRadixTreeIndex{{dictionary_segment}};
+  EXPECT_EQ(std::vector<ChunkOffset>(dictionary_index.cbegin(), dictionary_index.cend()),
+            std::vector<ChunkOffset>(index.cbegin(), index.cend()));
+  // Search values are converted to the column type.
+  EXPECT_EQ(dictionary_index.lower_bound({int32_t{3}}) - dictionary_index.cbegin(), 6);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, NaNIsNotIndexed) {
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto segment = std::make_shared<ValueSegment<float>>(false);
+  for (const auto value : {2.0f, nan, 0.0f, -nan, 4.0f, std::numeric_limits<float>::infinity()}) {
+    segment->append(value);
+  }
+  const auto index = AdaptiveRadixTreeIndex{{segment}};
+
+  EXPECT_EQ(std::vector<ChunkOffset>(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{2, 0, 4, 5}));
+  EXPECT_EQ(index.null_cbegin(), index.null_cend());
+  EXPECT_EQ(index.lower_bound({nan}), index.cend());
+  EXPECT_EQ(index.upper_bound({nan}), index.cend());
+  expect_bounds<float>(index, *segment, {-1.0f, 2.0f, 3.0f, std::numeric_limits<float>::infinity()});
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, EmptySegment) {
+  const auto segment = std::make_shared<ValueSegment<int64_t>>(true);
+  segment->append(NULL_VALUE);
+  const auto index = AdaptiveRadixTreeIndex{{segment}};
+  EXPECT_EQ(index.cbegin(), index.cend());
+  EXPECT_EQ(index.lower_bound({int64_t{1}}), index.cend());
+  EXPECT_EQ(index.upper_bound({int64_t{1}}), index.cend());
+  EXPECT_EQ(index.null_cend() - index.null_cbegin(), 1);
+
+  EXPECT_THROW(AdaptiveRadixTreeIndex({segment, segment}), std::logic_error);
+}
+
+}  // namespace opossum
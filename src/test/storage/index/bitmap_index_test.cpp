@@ -0,0 +1,87 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/bitmap_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageBitmapIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto value_segment = std::make_shared<ValueSegment<std::string>>(true);
+    for (const auto& value : {AllTypeVariant{"DE"}, AllTypeVariant{"US"}, NULL_VALUE, AllTypeVariant{"FR"},
+                              AllTypeVariant{"DE"}, AllTypeVariant{"US"}, AllTypeVariant{"DE"}}) {
+      value_segment->append(value);
+    }
+    _segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+    _index = std::make_shared<BitmapIndex>(_segment);
+  }
+
+  std::vector<uint32_t> chunk_offsets(const RoaringBitmap& bitmap) {
+    auto chunk_offsets = std::vector<uint32_t>{};
+    bitmap.for_each([&](const auto chunk_offset) { chunk_offsets.push_back(chunk_offset); });
+    return chunk_offsets;
+  }
+
+  std::shared_ptr<DictionarySegment<std::string>> _segment;
+  std::shared_ptr<BitmapIndex> _index;
+};
+
+TEST_F(StorageBitmapIndexTest, ScanTypes) {
+  EXPECT_EQ(chunk_offsets(_index->bitmap(ScanType::OpEquals, "DE")), (std::vector<uint32_t>{0, 4, 6}));
+  EXPECT_EQ(chunk_offsets(_index->bitmap(ScanType::OpNotEquals, "DE")), (std::vector<uint32_t>{1, 3, 5}));
+  EXPECT_EQ(chunk_offsets(_index->bitmap(ScanType::OpLessThan, "FR")), (std::vector<uint32_t>{0, 4, 6}));
+  EXPECT_EQ(chunk_offsets(_index->bitmap(ScanType::OpLessThanEquals, "FR")), (std::vector<uint32_t>{0, 3, 4, 6}));
+  EXPECT_EQ(chunk_offsets(_index->bitmap(ScanType::OpGreaterThan, "FR")), (std::vector<uint32_t>{1, 5}));
+  EXPECT_EQ(chunk_offsets(_index->bitmap(ScanType::OpGreaterThanEquals, "FR")), (std::vector<uint32_t>{1, 3, 5}));
+  EXPECT_EQ(chunk_offsets(_index->null_bitmap()), (std::vector<uint32_t>{2}));
+}
+
+TEST_F(StorageBitmapIndexTest, ValuesNotInDictionary) {
+  EXPECT_TRUE(_index->bitmap(ScanType::OpEquals, "ES").empty());
+  EXPECT_EQ(chunk_offsets(_index->bitmap(ScanType::OpGreaterThan, "ES")), (std::vector<uint32_t>{1, 3, 5}));
+  EXPECT_EQ(chunk_offsets(_index->bitmap(ScanType::OpLessThan, "ZZ")), (std::vector<uint32_t>{0, 1, 3, 4, 5, 6}));
+  EXPECT_TRUE(_index->bitmap(ScanType::OpGreaterThanEquals, "ZZ").empty());
+  EXPECT_TRUE(_index->bitmap(ScanType::OpNotEquals, NULL_VALUE).empty());
+}
+
+TEST_F(StorageBitmapIndexTest, NaNSearchValue) {
+  // NaN is neither smaller, equal, nor larger than any value, so only "!=" matches, for all non-NULL rows.
+  const auto value_segment = std::make_shared<ValueSegment<float>>(true);
+  for (const auto& value : {AllTypeVariant{2.0f}, NULL_VALUE, AllTypeVariant{1.0f}}) {
+    value_segment->append(value);
+  }
+  const auto index = BitmapIndex{std::make_shared<DictionarySegment<float>>(value_segment)};
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  EXPECT_EQ(chunk_offsets(index.bitmap(ScanType::OpNotEquals, nan)), (std::vector<uint32_t>{0, 2}));
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpLessThan, ScanType::OpLessThanEquals,
+                               ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    EXPECT_TRUE(index.bitmap(scan_type, nan).empty());
+  }
+}
+
+TEST_F(StorageBitmapIndexTest, StoredNaN) {
+  // Stored NaNs have their own bitmap, which only "!=" includes.
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto value_segment = std::make_shared<ValueSegment<float>>(true);
+  for (const auto& value : {AllTypeVariant{2.0f}, AllTypeVariant{nan}, NULL_VALUE, AllTypeVariant{1.0f}}) {
+    value_segment->append(value);
+  }
+  const auto index = BitmapIndex{std::make_shared<DictionarySegment<float>>(value_segment)};
+  EXPECT_EQ(chunk_offsets(index.bitmap(ScanType::OpNotEquals, 2.0f)), (std::vector<uint32_t>{1, 3}));
+  EXPECT_EQ(chunk_offsets(index.bitmap(ScanType::OpNotEquals, 7.0f)), (std::vector<uint32_t>{0, 1, 3}));
+  EXPECT_EQ(chunk_offsets(index.bitmap(ScanType::OpGreaterThan, 0.0f)), (std::vector<uint32_t>{0, 3}));
+  EXPECT_EQ(chunk_offsets(index.bitmap(ScanType::OpLessThanEquals, 2.0f)), (std::vector<uint32_t>{0, 3}));
+  EXPECT_TRUE(index.bitmap(ScanType::OpGreaterThanEquals, 3.0f).empty());
+  EXPECT_EQ(chunk_offsets(index.bitmap(ScanType::OpNotEquals, nan)), (std::vector<uint32_t>{0, 1, 3}));
+  EXPECT_TRUE(index.bitmap(ScanType::OpEquals, nan).empty());
+}
+
+TEST_F(StorageBitmapIndexTest, OnlyDictionarySegments) {
+  EXPECT_EQ(_index->indexed_segment(), _segment);
+  EXPECT_GT(_index->estimate_memory_usage(), 0);
+  EXPECT_THROW(BitmapIndex{std::make_shared<ValueSegment<int32_t>>()}, std::logic_error);
+}
+
+}  // namespace opossum
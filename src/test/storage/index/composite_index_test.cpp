@@ -0,0 +1,102 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/composite_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageCompositeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _segment_a = std::make_shared<ValueSegment<int32_t>>(false);
+    _segment_b = std::make_shared<ValueSegment<std::string>>(true);
+    const auto a = std::vector<int32_t>{2, 1, 2, 1, 3, 2, 1, 2};
+    const auto b = std::vector<AllTypeVariant>{"b", "a", "a", NULL_VALUE, "a", "b", "ab", "c"};
+    for (auto index = size_t{0}; index < a.size(); ++index) {
+      _segment_a->append(a[index]);
+      _segment_b->append(b[index]);
+    }
+    _index = std::make_shared<CompositeIndex>(
+        std::vector<std::shared_ptr<const AbstractSegment>>{_segment_a, _segment_b});
+  }
+
+  std::vector<ChunkOffset> range(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> _segment_a;
+  std::shared_ptr<ValueSegment<std::string>> _segment_b;
+  std::shared_ptr<CompositeIndex> _index;
+};
+
+TEST_F(StorageCompositeIndexTest, OrdersRowsLexicographically) {
+  EXPECT_EQ(_index->type(), SegmentIndexType::Composite);
+  EXPECT_EQ(range(_index->cbegin(), _index->cend()), (std::vector<ChunkOffset>{1, 6, 2, 0, 5, 7, 4}));
+  EXPECT_EQ(range(_index->null_cbegin(), _index->null_cend()), (std::vector<ChunkOffset>{3}));
+}
+
+TEST_F(StorageCompositeIndexTest, FullKeyLookups) {
+  EXPECT_EQ(range(_index->lower_bound({2, "b"}), _index->upper_bound({2, "b"})), (std::vector<ChunkOffset>{0, 5}));
+  EXPECT_EQ(range(_index->lower_bound({1, "a"}), _index->upper_bound({1, "a"})), (std::vector<ChunkOffset>{1}));
+  // "a" is a prefix of "ab", but the keys must not be confused.
+  EXPECT_EQ(range(_index->lower_bound({1, "ab"}), _index->upper_bound({1, "ab"})), (std::vector<ChunkOffset>{6}));
+
+  // Values that are not in the index yield empty ranges at the correct position.
+  EXPECT_EQ(_index->lower_bound({2, "aa"}), _index->upper_bound({2, "aa"}));
+  EXPECT_EQ(range(_index->cbegin(), _index->lower_bound({2, "aa"})), (std::vector<ChunkOffset>{1, 6, 2}));
+  EXPECT_EQ(_index->lower_bound({0, "z"}), _index->cbegin());
+  EXPECT_EQ(_index->upper_bound({3, "b"}), _index->cend());
+}
+
+TEST_F(StorageCompositeIndexTest, PrefixAndRangeLookups) {
+  // a = 2
+  EXPECT_EQ(range(_index->lower_bound({2}), _index->upper_bound({2})), (std::vector<ChunkOffset>{2, 0, 5, 7}));
+  // a = 1 AND b >= "ab". Row 3 is not listed because of its NULL.
+  EXPECT_EQ(range(_index->lower_bound({1, "ab"}), _index->upper_bound({1})), (std::vector<ChunkOffset>{6}));
+  // a = 2 AND b < "c"
+  EXPECT_EQ(range(_index->lower_bound({2}), _index->lower_bound({2, "c"})), (std::vector<ChunkOffset>{2, 0, 5}));
+  // a = 4
+  EXPECT_EQ(_index->lower_bound({4}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({4}), _index->cend());
+}
+
+TEST_F(StorageCompositeIndexTest, IndexesEncodedSegments) {
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(_segment_a);
+  const auto index = CompositeIndex{{_segment_b, dictionary_segment}};
+  EXPECT_TRUE(index.is_index_for({_segment_b, dictionary_segment}));
+  EXPECT_FALSE(index.is_index_for({dictionary_segment, _segment_b}));
+  EXPECT_FALSE(index.is_index_for({_segment_b}));
+
+  EXPECT_EQ(range(index.lower_bound({"a"}), index.upper_bound({"a"})), (std::vector<ChunkOffset>{1, 2, 4}));
+  EXPECT_EQ(range(index.lower_bound({"a", 2}), index.upper_bound({"a", 3})), (std::vector<ChunkOffset>{2, 4}));
+  EXPECT_GT(index.estimate_memory_usage(), size_t{0});
+}
+
+TEST_F(StorageCompositeIndexTest, NaNRowsAreNotIndexed) {
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto float_segment = std::make_shared<ValueSegment<float>>(true);
+  for (const auto& value : {AllTypeVariant{1.0f}, AllTypeVariant{nan}, AllTypeVariant{2.0f}, AllTypeVariant{nan},
+                            AllTypeVariant{0.5f}, AllTypeVariant{1.0f}, AllTypeVariant{nan}, AllTypeVariant{4.0f}}) {
+    float_segment->append(value);
+  }
+  // Row 3 has a NULL in the other column, so it is listed as NULL only.
+  const auto index = CompositeIndex{{_segment_a, float_segment, _segment_b}};
+  EXPECT_EQ(range(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{0, 5, 2, 7, 4}));
+  EXPECT_EQ(index.nan_positions(), (std::vector<ChunkOffset>{1, 6}));
+  EXPECT_EQ(range(index.null_cbegin(), index.null_cend()), (std::vector<ChunkOffset>{3}));
+
+  // Ranges never reach NaN rows, and NaN search values have no range.
+  EXPECT_EQ(range(index.upper_bound({2, 1.0f}), index.upper_bound({2})), (std::vector<ChunkOffset>{2, 7}));
+  EXPECT_EQ(index.lower_bound({2, nan}), index.cend());
+  EXPECT_EQ(index.upper_bound({2, nan}), index.cend());
+}
+
+TEST_F(StorageCompositeIndexTest, InvalidLookups) {
+  EXPECT_THROW(_index->lower_bound({}), std::logic_error);
+  EXPECT_THROW(_index->upper_bound({1, "a", 2}), std::logic_error);
+  EXPECT_THROW(_index->lower_bound({NULL_VALUE}), std::logic_error);
+  EXPECT_THROW(CompositeIndex{{}}, std::logic_error);
+}
+
+}  // namespace opossum
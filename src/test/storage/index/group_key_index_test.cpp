@@ -0,0 +1,87 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key_index.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto value_segment = std::make_shared<ValueSegment<std::string>>(true);
+    for (const auto& value : {AllTypeVariant{"hotel"}, AllTypeVariant{"delta"}, AllTypeVariant{"frank"},
+                              AllTypeVariant{"delta"}, NULL_VALUE, AllTypeVariant{"apple"}, AllTypeVariant{"charlie"},
+                              AllTypeVariant{"charlie"}, AllTypeVariant{"inbox"}, NULL_VALUE}) {
+      value_segment->append(value);
+    }
+    dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+    index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const AbstractSegment>>{dictionary_segment});
+  }
+
+  std::vector<ChunkOffset> positions(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) const {
+    return {begin, end};
+  }
+
+  std::shared_ptr<DictionarySegment<std::string>> dictionary_segment;
+  std::shared_ptr<GroupKeyIndex> index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, Postings) {
+  EXPECT_EQ(index->type(), SegmentIndexType::GroupKey);
+  EXPECT_TRUE(index->is_index_for({dictionary_segment}));
+  EXPECT_FALSE(index->is_index_for({}));
+
+  // Ordered by value, then by chunk offset.
+  EXPECT_EQ(positions(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{5, 6, 7, 1, 3, 2, 0, 8}));
+  EXPECT_EQ(positions(index->null_cbegin(), index->null_cend()), (std::vector<ChunkOffset>{4, 9}));
+  EXPECT_GT(index->estimate_memory_usage(), 0);
+}
+
+TEST_F(StorageGroupKeyIndexTest, LowerAndUpperBound) {
+  const auto delta = std::vector<AllTypeVariant>{"delta"};
+  EXPECT_EQ(positions(index->lower_bound(delta), index->upper_bound(delta)), (std::vector<ChunkOffset>{1, 3}));
+
+  // Values that do not occur yield an empty range at the position they would be at.
+  const auto echo = std::vector<AllTypeVariant>{"echo"};
+  EXPECT_EQ(index->lower_bound(echo), index->upper_bound(echo));
+  EXPECT_EQ(positions(index->lower_bound(echo), index->cend()), (std::vector<ChunkOffset>{2, 0, 8}));
+
+  EXPECT_EQ(index->lower_bound({"aardvark"}), index->cbegin());
+  EXPECT_EQ(index->upper_bound({"inbox"}), index->cend());
+  EXPECT_EQ(index->lower_bound({"zulu"}), index->cend());
+
+  EXPECT_THROW(index->lower_bound({}), std::logic_error);
+  EXPECT_THROW(index->lower_bound({NULL_VALUE}), std::logic_error);
+  EXPECT_THROW(index->upper_bound({"a", "b"}), std::logic_error);
+}
+
+TEST_F(StorageGroupKeyIndexTest, NaNHasNoPostings) {
+  // NaN is not ordered against any value, so no range of postings holds it.
+  const auto value_segment = std::make_shared<ValueSegment<float>>();
+  for (const auto value : {2.0f, 1.0f, 3.0f}) {
+    value_segment->append(value);
+  }
+  const auto float_index = GroupKeyIndex{{std::make_shared<DictionarySegment<float>>(value_segment)}};
+  const auto nan = std::vector<AllTypeVariant>{std::numeric_limits<float>::quiet_NaN()};
+  EXPECT_EQ(float_index.lower_bound(nan), float_index.cend());
+  EXPECT_EQ(float_index.upper_bound(nan), float_index.cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, StoredNaNIsNotIndexed) {
+  const auto value_segment = std::make_shared<ValueSegment<float>>();
+  for (const auto value : {2.0f, std::numeric_limits<float>::quiet_NaN(), 1.0f}) {
+    value_segment->append(value);
+  }
+  const auto float_index = GroupKeyIndex{{std::make_shared<DictionarySegment<float>>(value_segment)}};
+  EXPECT_EQ(positions(float_index.cbegin(), float_index.cend()), (std::vector<ChunkOffset>{2, 0}));
+  EXPECT_EQ(float_index.lower_bound({5.0f}), float_index.cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, RejectsOtherSegments) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  EXPECT_THROW(GroupKeyIndex({value_segment}), std::logic_error);
+  EXPECT_THROW(GroupKeyIndex({dictionary_segment, dictionary_segment}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include <set>
+
+#include "base_test.hpp"
+
+#include "storage/index/roaring_bitmap.hpp"
+
+namespace opossum {
+
+class StorageRoaringBitmapTest : public BaseTest {
+ protected:
+  RoaringBitmap make_bitmap(const std::set<uint32_t>& values) {
+    auto bitmap = RoaringBitmap{};
+    for (const auto value : values) {
+      bitmap.add(value);
+    }
+    return bitmap;
+  }
+
+  std::set<uint32_t> values_of(const RoaringBitmap& bitmap) {
+    auto values = std::set<uint32_t>{};
+    auto previous = std::optional<uint32_t>{};
+    bitmap.for_each([&](const auto value) {
+      EXPECT_TRUE(!previous || *previous < value);
+      previous = value;
+      values.insert(value);
+    });
+    EXPECT_EQ(bitmap.cardinality(), values.size());
+    return values;
+  }
+
+  // Values that fill array containers (sparse) and bitmap containers (dense), including the container borders.
+  std::set<uint32_t> sparse_values(const uint32_t step, const uint32_t offset) {
+    auto values = std::set<uint32_t>{};
+    for (auto value = offset; value < 300'000; value += step) {
+      values.insert(value);
+    }
+    values.insert(65'535);
+    values.insert(65'536);
+    values.insert(std::numeric_limits<uint32_t>::max());
+    return values;
+  }
+};
+
+TEST_F(StorageRoaringBitmapTest, AddAndContains) {
+  const auto values = sparse_values(3, 1);
+  const auto bitmap = make_bitmap(values);
+  EXPECT_EQ(values_of(bitmap), values);
+  EXPECT_FALSE(bitmap.empty());
+  EXPECT_TRUE(bitmap.contains(4));
+  EXPECT_FALSE(bitmap.contains(5));
+  EXPECT_TRUE(bitmap.contains(65'536));
+  EXPECT_FALSE(bitmap.contains(300'001));
+  EXPECT_TRUE(bitmap.contains(std::numeric_limits<uint32_t>::max()));
+
+  EXPECT_TRUE(RoaringBitmap{}.empty());
+  EXPECT_EQ(RoaringBitmap{}.cardinality(), 0);
+}
+
+TEST_F(StorageRoaringBitmapTest, CompressesDenseAndSparseValues) {
+  // Dense containers use a bit per value, sparse ones two bytes per value.
+  auto dense = make_bitmap(sparse_values(2, 0));
+  dense.shrink_to_fit();
+  EXPECT_LT(dense.estimate_memory_usage(), dense.cardinality() / 2);
+  auto sparse = make_bitmap(sparse_values(100, 0));
+  sparse.shrink_to_fit();
+  EXPECT_LT(sparse.estimate_memory_usage(), sparse.cardinality() * 3);
+}
+
+TEST_F(StorageRoaringBitmapTest, IntersectAndUnite) {
+  // Combine every kind of container with every other.
+  const auto steps = std::vector<uint32_t>{2, 3, 50, 70};
+  for (const auto left_step : steps) {
+    for (const auto right_step : steps) {
+      const auto left_values = sparse_values(left_step, 0);
+      const auto right_values = sparse_values(right_step, 1);
+      const auto left = make_bitmap(left_values);
+      const auto right = make_bitmap(right_values);
+
+      auto expected_intersection = std::set<uint32_t>{};
+      std::set_intersection(left_values.begin(), left_values.end(), right_values.begin(), right_values.end(),
+                            std::inserter(expected_intersection, expected_intersection.end()));
+      auto expected_union = left_values;
+      expected_union.insert(right_values.begin(), right_values.end());
+
+      EXPECT_EQ(values_of(left & right), expected_intersection);
+      EXPECT_EQ(values_of(left | right), expected_union);
+    }
+  }
+
+  const auto bitmap = make_bitmap({1, 70'000});
+  EXPECT_TRUE((bitmap & RoaringBitmap{}).empty());
+  EXPECT_EQ(values_of(bitmap | RoaringBitmap{}), (std::set<uint32_t>{1, 70'000}));
+  EXPECT_TRUE((bitmap & make_bitmap({2, 70'001})).empty());
+}
+
+TEST_F(StorageRoaringBitmapTest, UniteInPlace) {
+  // Accumulate bitmaps whose containers have new and existing keys, as the bitmap index does for ranges.
+  auto bitmap = RoaringBitmap{};
+  auto expected_values = std::set<uint32_t>{};
+  const auto steps_and_offsets = std::vector<std::pair<uint32_t, uint32_t>>{{70, 200'000}, {50, 0}, {3, 1}, {2, 0}};
+  for (const auto& [step, offset] : steps_and_offsets) {
+    const auto values = sparse_values(step, offset);
+    bitmap |= make_bitmap(values);
+    expected_values.insert(values.begin(), values.end());
+    EXPECT_EQ(values_of(bitmap), expected_values);
+  }
+
+  bitmap |= RoaringBitmap{};
+  EXPECT_EQ(values_of(bitmap), expected_values);
+  auto empty = RoaringBitmap{};
+  empty |= make_bitmap({1, 70'000});
+  EXPECT_EQ(values_of(empty), (std::set<uint32_t>{1, 70'000}));
+}
+
+}  // namespace opossum
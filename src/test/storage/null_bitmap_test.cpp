@@ -0,0 +1,88 @@
+#include "base_test.hpp"
+
+#include "storage/null_bitmap.hpp"
+
+namespace opossum {
+
+class StorageNullBitmapTest : public BaseTest {};
+
+TEST_F(StorageNullBitmapTest, PushBackAndAccess) {
+  auto bitmap = NullBitmap{};
+  EXPECT_TRUE(bitmap.empty());
+  EXPECT_FALSE(bitmap.has_nulls());
+
+  for (auto index = size_t{0}; index < 130; ++index) {
+    bitmap.push_back(index % 3 == 0);
+  }
+
+  EXPECT_EQ(bitmap.size(), 130);
+  EXPECT_TRUE(bitmap.has_nulls());
+  EXPECT_EQ(bitmap.null_count(), 44);
+  for (auto index = size_t{0}; index < 130; ++index) {
+    EXPECT_EQ(bitmap[index], index % 3 == 0);
+  }
+
+  const auto& words = bitmap.words();
+  ASSERT_EQ(words.size(), 3);
+  EXPECT_EQ(words[0] & 0b1111, 0b1001);
+  EXPECT_EQ(words[2], 0b10);
+}
+
+TEST_F(StorageNullBitmapTest, NoNulls) {
+  auto bitmap = NullBitmap{};
+  for (auto index = size_t{0}; index < 100; ++index) {
+    bitmap.push_back(false);
+  }
+  EXPECT_FALSE(bitmap.has_nulls());
+  EXPECT_EQ(bitmap.null_count(), 0);
+  EXPECT_EQ(bitmap.null_count(10, 90), 0);
+}
+
+TEST_F(StorageNullBitmapTest, Set) {
+  auto bitmap = NullBitmap{70};
+  EXPECT_EQ(bitmap.size(), 70);
+  EXPECT_FALSE(bitmap.has_nulls());
+
+  bitmap.set(65, true);
+  bitmap.set(65, true);
+  EXPECT_TRUE(bitmap[65]);
+  EXPECT_EQ(bitmap.null_count(), 1);
+
+  bitmap.set(65, false);
+  EXPECT_FALSE(bitmap[65]);
+  EXPECT_FALSE(bitmap.has_nulls());
+
+  EXPECT_THROW(bitmap.set(70, true), std::logic_error);
+}
+
+TEST_F(StorageNullBitmapTest, AllNull) {
+  const auto bitmap = NullBitmap{70, true};
+  EXPECT_EQ(bitmap.null_count(), 70);
+  EXPECT_EQ(bitmap.null_count(0, 70), 70);
+  // Bits beyond the size are zero.
+  EXPECT_EQ(bitmap.words()[1], 0b111111);
+}
+
+TEST_F(StorageNullBitmapTest, RangeNullCount) {
+  auto bitmap = NullBitmap{};
+  for (auto index = size_t{0}; index < 200; ++index) {
+    bitmap.push_back(index % 2 == 1);
+  }
+
+  EXPECT_EQ(bitmap.null_count(0, 0), 0);
+  EXPECT_EQ(bitmap.null_count(0, 200), 100);
+  EXPECT_EQ(bitmap.null_count(1, 2), 1);
+  EXPECT_EQ(bitmap.null_count(3, 63), 30);
+  EXPECT_EQ(bitmap.null_count(63, 129), 33);
+  EXPECT_EQ(bitmap.null_count(64, 128), 32);
+  EXPECT_THROW(bitmap.null_count(10, 201), std::logic_error);
+}
+
+TEST_F(StorageNullBitmapTest, MemoryUsage) {
+  auto bitmap = NullBitmap{};
+  EXPECT_EQ(bitmap.estimate_memory_usage(), 0);
+  bitmap.reserve(65);
+  EXPECT_EQ(bitmap.estimate_memory_usage(), 16);
+}
+
+}  // namespace opossum
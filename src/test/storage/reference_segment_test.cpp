@@ -27,8 +27,8 @@ class ReferenceSegmentTest : public BaseTest {
       _test_table_dict->append({value, 100 + value});
     }
 
-    _test_table_dict->compress_chunk(ChunkID{0});
-    _test_table_dict->compress_chunk(ChunkID{1});
+    _test_table_dict->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+    _test_table_dict->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
 
     StorageManager::get().add_table("test_table_dict", _test_table_dict);
   }
@@ -0,0 +1,78 @@
+#include "base_test.hpp"
+
+#include "storage/run_length_segment.hpp"
+
+namespace opossum {
+
+class StorageRunLengthSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+  std::shared_ptr<ValueSegment<std::string>> value_segment_str{std::make_shared<ValueSegment<std::string>>()};
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentInt) {
+  for (const auto& value : {AllTypeVariant{1}, AllTypeVariant{1}, AllTypeVariant{1}, AllTypeVariant{2}, NULL_VALUE,
+                           NULL_VALUE, AllTypeVariant{2}, AllTypeVariant{2}, AllTypeVariant{1}}) {
+    value_segment_int->append(value);
+  }
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(rle_segment->size(), 9);
+  EXPECT_EQ(rle_segment->run_count(), 5);
+  EXPECT_EQ(rle_segment->end_positions(), std::vector<ChunkOffset>({2, 3, 5, 7, 8}));
+  EXPECT_EQ(rle_segment->null_values(), std::vector<bool>({false, false, true, false, false}));
+  EXPECT_EQ(rle_segment->values()[0], 1);
+  EXPECT_EQ(rle_segment->values()[1], 2);
+  EXPECT_EQ(rle_segment->values()[3], 2);
+  EXPECT_EQ(rle_segment->values()[4], 1);
+
+  EXPECT_EQ(rle_segment->run_index(0), 0);
+  EXPECT_EQ(rle_segment->run_index(2), 0);
+  EXPECT_EQ(rle_segment->run_index(3), 1);
+  EXPECT_EQ(rle_segment->run_index(8), 4);
+}
+
+TEST_F(StorageRunLengthSegmentTest, Access) {
+  value_segment_str->append("a");
+  value_segment_str->append("a");
+  value_segment_str->append("b");
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<std::string>>(value_segment_str);
+  EXPECT_EQ(rle_segment->run_count(), 2);
+  EXPECT_EQ((*rle_segment)[1], AllTypeVariant{"a"});
+  EXPECT_EQ(rle_segment->get(2), "b");
+  EXPECT_EQ(rle_segment->get_typed_value(0), "a");
+
+  EXPECT_THROW((*rle_segment)[3], std::logic_error);
+  EXPECT_THROW(rle_segment->get(3), std::logic_error);
+}
+
+TEST_F(StorageRunLengthSegmentTest, NullValueHandling) {
+  value_segment_int->append(NULL_VALUE);
+  value_segment_int->append(3);
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_TRUE(variant_is_null((*rle_segment)[0]));
+  EXPECT_EQ(rle_segment->get_typed_value(0), std::nullopt);
+  EXPECT_THROW(rle_segment->get(0), std::logic_error);
+  EXPECT_EQ(rle_segment->get(1), 3);
+}
+
+TEST_F(StorageRunLengthSegmentTest, CompressEmptySegment) {
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(rle_segment->size(), 0);
+  EXPECT_EQ(rle_segment->run_count(), 0);
+  EXPECT_EQ(rle_segment->estimate_memory_usage(), 0);
+}
+
+TEST_F(StorageRunLengthSegmentTest, MemoryUsage) {
+  for (auto index = 0; index < 1000; ++index) {
+    value_segment_int->append(index / 500);
+  }
+
+  const auto rle_segment = std::make_shared<RunLengthSegment<int32_t>>(value_segment_int);
+  // 2 runs: 2 * 4 bytes for values + 2 * 4 bytes for end positions + one 64-bit word for the NULL flags.
+  EXPECT_EQ(rle_segment->estimate_memory_usage(), size_t{24});
+}
+
+}  // namespace opossum
@@ -0,0 +1,219 @@
+#include "base_test.hpp"
+
+#include "storage/alp_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _int_segment = std::make_shared<ValueSegment<int32_t>>(true);
+    _string_segment = std::make_shared<ValueSegment<std::string>>(true);
+    for (auto index = int32_t{0}; index < 10; ++index) {
+      if (index % 4 == 3) {
+        _int_segment->append(NULL_VALUE);
+        _string_segment->append(NULL_VALUE);
+      } else {
+        _int_segment->append(index % 3);
+        _string_segment->append("value" + std::to_string(index % 3));
+      }
+    }
+  }
+
+  // Collects all positions of a segment as optionals, the chunk offsets have to be consecutive.
+  template <typename T>
+  std::vector<std::optional<T>> collect(const AbstractSegment& segment) {
+    auto result = std::vector<std::optional<T>>{};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      EXPECT_EQ(position.chunk_offset(), result.size());
+      result.emplace_back(position.is_null() ? std::nullopt : std::optional<T>{position.value()});
+    });
+    return result;
+  }
+
+  template <typename T>
+  std::vector<std::optional<T>> collect_filtered(const AbstractSegment& segment,
+                                                 const std::vector<ChunkOffset>& positions) {
+    auto result = std::vector<std::optional<T>>{};
+    segment_iterate_filtered<T>(segment, positions, [&](const auto& position) {
+      EXPECT_EQ(position.chunk_offset(), result.size());
+      result.emplace_back(position.is_null() ? std::nullopt : std::optional<T>{position.value()});
+    });
+    return result;
+  }
+
+  // Reads all values of a segment through operator[].
+  template <typename T>
+  std::vector<std::optional<T>> expected(const AbstractSegment& segment) {
+    auto result = std::vector<std::optional<T>>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      const auto variant = segment[chunk_offset];
+      result.emplace_back(variant_is_null(variant) ? std::nullopt : std::optional<T>{type_cast<T>(variant)});
+    }
+    return result;
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> _int_segment;
+  std::shared_ptr<ValueSegment<std::string>> _string_segment;
+};
+
+TEST_F(StorageSegmentIterateTest, ValueSegment) {
+  EXPECT_EQ(collect<int32_t>(*_int_segment), expected<int32_t>(*_int_segment));
+  EXPECT_EQ(collect<std::string>(*_string_segment), expected<std::string>(*_string_segment));
+
+  auto segment = ValueSegment<int32_t>{false};
+  segment.append(4);
+  segment.append(2);
+  EXPECT_EQ(collect<int32_t>(segment), (std::vector<std::optional<int32_t>>{4, 2}));
+}
+
+TEST_F(StorageSegmentIterateTest, DictionarySegment) {
+  const auto int_dictionary_segment = DictionarySegment<int32_t>{_int_segment};
+  EXPECT_EQ(collect<int32_t>(int_dictionary_segment), expected<int32_t>(*_int_segment));
+
+  const auto string_dictionary_segment = DictionarySegment<std::string>{_string_segment};
+  EXPECT_EQ(collect<std::string>(string_dictionary_segment), expected<std::string>(*_string_segment));
+}
+
+TEST_F(StorageSegmentIterateTest, Filtered) {
+  const auto positions = std::vector<ChunkOffset>{9, 3, 0, 3, 5};
+  const auto expected_values = std::vector<std::optional<int32_t>>{0, std::nullopt, 0, std::nullopt, 2};
+  EXPECT_EQ(collect_filtered<int32_t>(*_int_segment, positions), expected_values);
+
+  const auto dictionary_segment = DictionarySegment<int32_t>{_int_segment};
+  EXPECT_EQ(collect_filtered<int32_t>(dictionary_segment, positions), expected_values);
+  // Few positions are read one by one instead of decoding the whole attribute vector.
+  EXPECT_EQ(collect_filtered<int32_t>(dictionary_segment, {5}), (std::vector<std::optional<int32_t>>{2}));
+
+  const auto string_dictionary_segment = DictionarySegment<std::string>{_string_segment};
+  EXPECT_EQ(collect_filtered<std::string>(string_dictionary_segment, {1, 7}),
+            (std::vector<std::optional<std::string>>{"value1", std::nullopt}));
+}
+
+TEST_F(StorageSegmentIterateTest, ReferenceSegment) {
+  const auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int", true);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _int_segment->size(); ++chunk_offset) {
+    table->append({(*_int_segment)[chunk_offset]});
+  }
+  table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+
+  const auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>{
+      RowID{ChunkID{0}, 1}, RowID{ChunkID{0}, 3}, NULL_ROW_ID, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2},
+      RowID{ChunkID{0}, 0}, RowID{ChunkID{2}, 1}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+  EXPECT_EQ(collect<int32_t>(reference_segment),
+            (std::vector<std::optional<int32_t>>{1, std::nullopt, std::nullopt, 1, 0, 0, 0}));
+  EXPECT_EQ(collect<int32_t>(reference_segment), expected<int32_t>(reference_segment));
+  EXPECT_EQ(collect_filtered<int32_t>(reference_segment, {6, 2, 3}),
+            (std::vector<std::optional<int32_t>>{0, std::nullopt, 1}));
+}
+
+TEST_F(StorageSegmentIterateTest, ReferenceSegmentAlternatingChunks) {
+  // Every RowID starts a new run of a single position, so values are read one by one instead of decoding the segment.
+  const auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", "string", true);
+  for (auto row = int32_t{0}; row < 2'000; ++row) {
+    table->append({row % 10 == 9 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{"value" + std::to_string(row)}});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  table->compress_chunk(ChunkID{1}, EncodingType::Dictionary);
+
+  const auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+    pos_list->push_back(RowID{ChunkID{0}, chunk_offset});
+    pos_list->push_back(RowID{ChunkID{1}, static_cast<ChunkOffset>(999 - chunk_offset)});
+  }
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  EXPECT_EQ(collect<std::string>(reference_segment), expected<std::string>(reference_segment));
+}
+
+TEST_F(StorageSegmentIterateTest, RunLengthSegment) {
+  const auto run_length_segment = RunLengthSegment<int32_t>{_int_segment};
+  EXPECT_EQ(collect<int32_t>(run_length_segment), expected<int32_t>(*_int_segment));
+  EXPECT_EQ(collect_filtered<int32_t>(run_length_segment, {2, 3}),
+            (std::vector<std::optional<int32_t>>{2, std::nullopt}));
+
+  // Runs of several rows, positions within the same run, the next run, far ahead, and backwards.
+  const auto value_segment = std::make_shared<ValueSegment<std::string>>(true);
+  for (auto index = int32_t{0}; index < 20; ++index) {
+    const auto run = index / 5;
+    value_segment->append(run == 2 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{"run" + std::to_string(run)});
+  }
+  const auto string_run_length_segment = RunLengthSegment<std::string>{value_segment};
+  EXPECT_EQ(collect<std::string>(string_run_length_segment), expected<std::string>(*value_segment));
+  const auto positions = std::vector<ChunkOffset>{0, 4, 5, 6, 12, 19, 1, 18, 9};
+  const auto expected_values = std::vector<std::optional<std::string>>{
+      "run0", "run0", "run1", "run1", std::nullopt, "run3", "run0", "run3", "run1"};
+  EXPECT_EQ(collect_filtered<std::string>(string_run_length_segment, positions), expected_values);
+}
+
+TEST_F(StorageSegmentIterateTest, FrameOfReferenceSegment) {
+  // Several blocks, the last one partially filled.
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>(true);
+  for (auto index = int64_t{0}; index < 5'000; ++index) {
+    value_segment->append(index % 7 == 3 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index * 3 - 1'000});
+  }
+  const auto frame_of_reference_segment = FrameOfReferenceSegment<int64_t>{value_segment};
+  const auto all_values = expected<int64_t>(*value_segment);
+  EXPECT_EQ(collect<int64_t>(frame_of_reference_segment), all_values);
+
+  // Many positions decode whole blocks, few positions are looked up one by one.
+  auto positions = std::vector<ChunkOffset>{};
+  auto expected_values = std::vector<std::optional<int64_t>>{};
+  for (auto position = ChunkOffset{0}; position < 5'000; position += 3) {
+    positions.push_back(4'999 - position);
+    expected_values.push_back(all_values[4'999 - position]);
+  }
+  EXPECT_EQ(collect_filtered<int64_t>(frame_of_reference_segment, positions), expected_values);
+  EXPECT_EQ(collect_filtered<int64_t>(frame_of_reference_segment, {3, 4'000}),
+            (std::vector<std::optional<int64_t>>{std::nullopt, all_values[4'000]}));
+
+  const auto int_frame_of_reference_segment = FrameOfReferenceSegment<int32_t>{_int_segment};
+  EXPECT_EQ(collect<int32_t>(int_frame_of_reference_segment), expected<int32_t>(*_int_segment));
+}
+
+TEST_F(StorageSegmentIterateTest, ALPSegment) {
+  // Several blocks with exceptions, the last one partially filled.
+  const auto value_segment = std::make_shared<ValueSegment<double>>(true);
+  for (auto index = int32_t{0}; index < 2'500; ++index) {
+    if (index % 9 == 4) {
+      value_segment->append(NULL_VALUE);
+    } else {
+      value_segment->append(index % 13 == 0 ? 1.0 / (index + 3) : index * 0.25);
+    }
+  }
+  const auto alp_segment = ALPSegment<double>{value_segment};
+  const auto all_values = expected<double>(*value_segment);
+  EXPECT_EQ(collect<double>(alp_segment), all_values);
+
+  auto positions = std::vector<ChunkOffset>{};
+  auto expected_values = std::vector<std::optional<double>>{};
+  for (auto position = ChunkOffset{0}; position < 2'500; position += 2) {
+    positions.push_back(position);
+    expected_values.push_back(all_values[position]);
+  }
+  EXPECT_EQ(collect_filtered<double>(alp_segment, positions), expected_values);
+  EXPECT_EQ(collect_filtered<double>(alp_segment, {2'000, 4, 13}),
+            (std::vector<std::optional<double>>{all_values[2'000], std::nullopt, all_values[13]}));
+}
+
+TEST_F(StorageSegmentIterateTest, FSSTSegment) {
+  const auto fsst_segment = FSSTSegment<std::string>{_string_segment};
+  EXPECT_EQ(collect<std::string>(fsst_segment), expected<std::string>(*_string_segment));
+  EXPECT_EQ(collect_filtered<std::string>(fsst_segment, {7, 2, 1}),
+            (std::vector<std::optional<std::string>>{std::nullopt, "value2", "value1"}));
+}
+
+TEST_F(StorageSegmentIterateTest, FallBackToOperator) {
+  // A segment of another data type needs conversion.
+  EXPECT_EQ(collect<int64_t>(*_int_segment), expected<int64_t>(*_int_segment));
+  EXPECT_EQ(collect_filtered<int64_t>(*_int_segment, {2, 3}), (std::vector<std::optional<int64_t>>{2, std::nullopt}));
+}
+
+}  // namespace opossum
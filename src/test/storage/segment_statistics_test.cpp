@@ -0,0 +1,146 @@
+#include <limits>
+
+#include "base_test.hpp"
+
+#include "storage/segment_statistics.hpp"
+
+namespace opossum {
+
+class StorageSegmentStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto& value : {AllTypeVariant{10}, NULL_VALUE, AllTypeVariant{30}, AllTypeVariant{20}, NULL_VALUE}) {
+      value_segment_int->append(value);
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+};
+
+TEST_F(StorageSegmentStatisticsTest, MinMaxAndCounts) {
+  const auto statistics = SegmentStatistics<int32_t>{*value_segment_int};
+  EXPECT_EQ(statistics.min(), 10);
+  EXPECT_EQ(statistics.max(), 30);
+  EXPECT_EQ(statistics.row_count(), 5);
+  EXPECT_EQ(statistics.null_count(), 2);
+  EXPECT_FALSE(statistics.distinct_count());
+
+  const auto statistics_with_distinct_count = SegmentStatistics<int32_t>{*value_segment_int, 3};
+  EXPECT_EQ(statistics_with_distinct_count.distinct_count(), 3);
+}
+
+TEST_F(StorageSegmentStatisticsTest, CanPrune) {
+  const auto statistics = SegmentStatistics<int32_t>{*value_segment_int};
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 5));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 10));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 15));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, 31));
+
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpNotEquals, 10));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThan, 10));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThan, 11));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpLessThanEquals, 9));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpLessThanEquals, 10));
+
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThan, 30));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThan, 29));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpGreaterThanEquals, 31));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpGreaterThanEquals, 30));
+
+  // The AllTypeVariant overload converts the search value and never matches NULL.
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, AllTypeVariant{int64_t{42}}));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, AllTypeVariant{20.0}));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpNotEquals, NULL_VALUE));
+}
+
+TEST_F(StorageSegmentStatisticsTest, SingleValue) {
+  auto value_segment = ValueSegment<std::string>{};
+  value_segment.append("b");
+  value_segment.append("b");
+
+  const auto statistics = SegmentStatistics<std::string>{value_segment};
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpNotEquals, std::string{"b"}));
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpNotEquals, std::string{"a"}));
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpEquals, std::string{"a"}));
+}
+
+TEST_F(StorageSegmentStatisticsTest, OnlyNulls) {
+  auto value_segment = ValueSegment<int32_t>{true};
+  value_segment.append(NULL_VALUE);
+
+  const auto statistics = SegmentStatistics<int32_t>{value_segment};
+  EXPECT_FALSE(statistics.min());
+  EXPECT_FALSE(statistics.max());
+  EXPECT_TRUE(statistics.can_prune(ScanType::OpNotEquals, 1));
+}
+
+TEST_F(StorageSegmentStatisticsTest, NaNPreventsPruning) {
+  auto value_segment = ValueSegment<double>{};
+  value_segment.append(1.0);
+  value_segment.append(std::numeric_limits<double>::quiet_NaN());
+
+  const auto statistics = SegmentStatistics<double>{value_segment};
+  EXPECT_EQ(statistics.min(), 1.0);
+  EXPECT_EQ(statistics.max(), 1.0);
+  EXPECT_FALSE(statistics.can_prune(ScanType::OpEquals, 5.0));
+}
+
+TEST_F(StorageSegmentStatisticsTest, BloomFilter) {
+  const auto statistics = SegmentStatistics<int32_t>{*value_segment_int};
+  EXPECT_FALSE(statistics.bloom_filter());
+
+  auto value_segment = ValueSegment<int32_t>{};
+  for (auto value = int32_t{0}; value < 1'000; value += 2) {
+    value_segment.append(value);
+  }
+  const auto statistics_with_bloom_filter = SegmentStatistics<int32_t>{value_segment, std::nullopt, true};
+  ASSERT_TRUE(statistics_with_bloom_filter.bloom_filter());
+
+  // All values within [min, max], so only the Bloom filter can prune.
+  auto pruned_count = size_t{0};
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    const auto pruned = statistics_with_bloom_filter.can_prune(ScanType::OpEquals, value);
+    if (value % 2 == 0) {
+      EXPECT_FALSE(pruned);
+    }
+    pruned_count += pruned;
+  }
+  EXPECT_GT(pruned_count, 450);
+  EXPECT_FALSE(statistics_with_bloom_filter.can_prune(ScanType::OpNotEquals, 1));
+}
+
+TEST_F(StorageSegmentStatisticsTest, ComputedByCompressChunk) {
+  auto table = Table{3};
+  table.add_column("a", "int", false);
+  table.add_column("b", "string", false);
+  table.append({4, "x"});
+  table.append({6, "y"});
+  table.append({4, "x"});
+
+  EXPECT_FALSE(table.get_chunk(ChunkID{0})->segment_statistics(ColumnID{0}));
+
+  table.compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  const auto chunk = table.get_chunk(ChunkID{0});
+  const auto statistics = std::dynamic_pointer_cast<const SegmentStatistics<int32_t>>(
+      chunk->segment_statistics(ColumnID{0}));
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->min(), 4);
+  EXPECT_EQ(statistics->max(), 6);
+  EXPECT_EQ(statistics->distinct_count(), 2);
+  EXPECT_TRUE(chunk->segment_statistics(ColumnID{1})->can_prune(ScanType::OpEquals, "z"));
+  EXPECT_FALSE(statistics->bloom_filter());
+
+  table.set_column_bloom_filter(ColumnID{1}, true);
+  EXPECT_TRUE(table.column_bloom_filter(ColumnID{1}));
+  table.append({5, "z"});
+  table.compress_chunk(ChunkID{1});
+  const auto string_statistics = std::dynamic_pointer_cast<const SegmentStatistics<std::string>>(
+      table.get_chunk(ChunkID{1})->segment_statistics(ColumnID{1}));
+  ASSERT_TRUE(string_statistics);
+  ASSERT_TRUE(string_statistics->bloom_filter());
+  EXPECT_FALSE(string_statistics->can_prune(ScanType::OpEquals, std::string{"z"}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#include "base_test.hpp"
+
+#include "storage/string_dictionary.hpp"
+
+namespace opossum {
+
+class StorageStringDictionaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto index = 0; index < 100; ++index) {
+      // Zero-padded to keep the lexicographical order equal to the numerical one.
+      auto number = std::to_string(index * 2);
+      values.push_back("https://example.com/products/" + std::string(3 - number.size(), '0') + number);
+    }
+  }
+
+  std::vector<std::string> values;
+};
+
+TEST_F(StorageStringDictionaryTest, AccessValues) {
+  for (const auto block_size : {uint32_t{1}, uint32_t{4}, StringDictionary::FRONT_CODED_BLOCK_SIZE}) {
+    const auto dictionary = StringDictionary{values, block_size};
+    EXPECT_EQ(dictionary.size(), values.size());
+    EXPECT_EQ(dictionary.block_size(), block_size);
+    for (auto value_id = ValueID{0}; value_id < values.size(); ++value_id) {
+      EXPECT_EQ(dictionary[value_id], values[value_id]);
+    }
+
+    auto visited_count = size_t{0};
+    dictionary.for_each([&](const ValueID value_id, const std::string_view value) {
+      EXPECT_EQ(value_id, visited_count);
+      EXPECT_EQ(value, values[value_id]);
+      ++visited_count;
+    });
+    EXPECT_EQ(visited_count, values.size());
+  }
+}
+
+TEST_F(StorageStringDictionaryTest, LowerUpperBound) {
+  for (const auto block_size : {uint32_t{1}, uint32_t{4}, StringDictionary::FRONT_CODED_BLOCK_SIZE}) {
+    const auto dictionary = StringDictionary{values, block_size};
+    // Entries are the even numbers from 000 to 198.
+    EXPECT_EQ(dictionary.lower_bound("https://example.com/products/040"), ValueID{20});
+    EXPECT_EQ(dictionary.upper_bound("https://example.com/products/040"), ValueID{21});
+    EXPECT_EQ(dictionary.lower_bound("https://example.com/products/041"), ValueID{21});
+    EXPECT_EQ(dictionary.upper_bound("https://example.com/products/041"), ValueID{21});
+    EXPECT_EQ(dictionary.lower_bound("https://example.com/products/063"), ValueID{32});
+    EXPECT_EQ(dictionary.lower_bound("https://example.com/products/064"), ValueID{32});
+    EXPECT_EQ(dictionary.upper_bound("https://example.com/products/064"), ValueID{33});
+    EXPECT_EQ(dictionary.lower_bound(""), ValueID{0});
+    EXPECT_EQ(dictionary.upper_bound(""), ValueID{0});
+    EXPECT_EQ(dictionary.lower_bound("https://example.com/products/198"), ValueID{99});
+    EXPECT_EQ(dictionary.upper_bound("https://example.com/products/198"), ValueID{100});
+    EXPECT_EQ(dictionary.lower_bound("z"), ValueID{100});
+  }
+}
+
+TEST_F(StorageStringDictionaryTest, EmptyAndLongValues) {
+  const auto empty_dictionary = StringDictionary{std::vector<std::string>{}};
+  EXPECT_EQ(empty_dictionary.size(), 0);
+  EXPECT_EQ(empty_dictionary.lower_bound("a"), ValueID{0});
+  EXPECT_EQ(empty_dictionary.estimate_memory_usage(), 0);
+
+  // Lengths of 128 and more need multi-byte varints.
+  const auto long_values = std::vector<std::string>{"", std::string(200, 'a'), std::string(300, 'a') + "b"};
+  const auto dictionary = StringDictionary{long_values, 4};
+  EXPECT_EQ(dictionary[ValueID{0}], "");
+  EXPECT_EQ(dictionary[ValueID{1}], long_values[1]);
+  EXPECT_EQ(dictionary[ValueID{2}], long_values[2]);
+  EXPECT_EQ(dictionary.lower_bound(std::string(250, 'a')), ValueID{2});
+}
+
+TEST_F(StorageStringDictionaryTest, MemoryUsage) {
+  const auto plain_dictionary = StringDictionary{values, 1};
+  // Each entry needs a length byte and 32 characters, plus a four-byte restart offset.
+  EXPECT_EQ(plain_dictionary.estimate_memory_usage(), 100 * (1 + 32 + 4));
+  EXPECT_EQ(StringDictionary::estimate_memory_usage(values, 1), plain_dictionary.estimate_memory_usage());
+
+  // The shared URL prefix is only stored once per block, so the constructor picks front coding.
+  const auto dictionary = StringDictionary{values};
+  EXPECT_EQ(dictionary.block_size(), StringDictionary::FRONT_CODED_BLOCK_SIZE);
+  EXPECT_EQ(StringDictionary::estimate_memory_usage(values, dictionary.block_size()),
+            dictionary.estimate_memory_usage());
+  EXPECT_LT(dictionary.estimate_memory_usage() * 4, plain_dictionary.estimate_memory_usage());
+}
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#include "base_test.hpp"
+
+#include "storage/column_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/table_statistics.hpp"
+
+namespace opossum {
+
+class StorageTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (const auto& value : {AllTypeVariant{10}, NULL_VALUE, AllTypeVariant{30}, AllTypeVariant{20}, NULL_VALUE}) {
+      value_segment_int->append(value);
+    }
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> value_segment_int{std::make_shared<ValueSegment<int32_t>>(true)};
+};
+
+TEST_F(StorageTableStatisticsTest, ColumnStatistics) {
+  const auto statistics = ColumnStatistics<int32_t>{*value_segment_int};
+  EXPECT_EQ(statistics.data_type(), DataType::Int);
+  EXPECT_EQ(statistics.row_count(), 5);
+  EXPECT_EQ(statistics.null_count(), 2);
+  EXPECT_DOUBLE_EQ(statistics.null_fraction(), 0.4);
+  EXPECT_EQ(statistics.distinct_count(), 3);
+  EXPECT_DOUBLE_EQ(statistics.histogram().total_count(), 3.0);
+
+  EXPECT_DOUBLE_EQ(statistics.estimate_selectivity(ScanType::OpEquals, AllTypeVariant{20}), 0.2);
+  EXPECT_DOUBLE_EQ(statistics.estimate_selectivity(ScanType::OpEquals, AllTypeVariant{40}), 0.0);
+  // NULLs match neither a predicate nor its negation.
+  EXPECT_DOUBLE_EQ(statistics.estimate_selectivity(ScanType::OpNotEquals, AllTypeVariant{40}), 0.6);
+  EXPECT_DOUBLE_EQ(statistics.estimate_selectivity(ScanType::OpGreaterThanEquals, AllTypeVariant{10}), 0.6);
+  EXPECT_DOUBLE_EQ(statistics.estimate_selectivity(ScanType::OpEquals, NULL_VALUE), 0.0);
+
+  const auto empty_statistics = ColumnStatistics<int32_t>{ValueSegment<int32_t>{}};
+  EXPECT_DOUBLE_EQ(empty_statistics.estimate_selectivity(ScanType::OpNotEquals, 1), 0.0);
+  EXPECT_DOUBLE_EQ(empty_statistics.null_fraction(), 0.0);
+}
+
+TEST_F(StorageTableStatisticsTest, MergeColumnStatistics) {
+  auto value_segment = ValueSegment<int32_t>{};
+  for (const auto value : {20, 20, 40}) {
+    value_segment.append(value);
+  }
+  const auto statistics = ColumnStatistics<int32_t>{*value_segment_int};
+  const auto merged = statistics.merged(ColumnStatistics<int32_t>{value_segment});
+  EXPECT_EQ(merged->row_count(), 8);
+  EXPECT_EQ(merged->null_count(), 2);
+  EXPECT_EQ(merged->distinct_count(), 4);
+  EXPECT_NEAR(merged->estimate_selectivity(ScanType::OpGreaterThan, AllTypeVariant{35}), 0.125, 0.1);
+
+  EXPECT_THROW(statistics.merged(ColumnStatistics<float>{ValueSegment<float>{}}), std::logic_error);
+}
+
+TEST_F(StorageTableStatisticsTest, ComputedByCompressChunk) {
+  auto table = Table{100};
+  table.add_column("a", "int", false);
+  table.add_column("b", "string", true);
+  EXPECT_FALSE(table.table_statistics());
+
+  for (auto value = int32_t{0}; value < 300; ++value) {
+    table.append({value, value % 2 ? AllTypeVariant{std::string{"odd"}} : NULL_VALUE});
+  }
+  table.compress_chunk(ChunkID{0});
+  table.compress_chunk(ChunkID{1});
+
+  const auto statistics = table.table_statistics();
+  ASSERT_TRUE(statistics);
+  EXPECT_EQ(statistics->row_count(), 200);
+  EXPECT_EQ(statistics->column_count(), 2);
+  EXPECT_NEAR(statistics->column_statistics(ColumnID{0})->distinct_count(), 200, 10);
+  EXPECT_DOUBLE_EQ(statistics->column_statistics(ColumnID{1})->null_fraction(), 0.5);
+  EXPECT_EQ(statistics->column_statistics(ColumnID{1})->distinct_count(), 1);
+
+  EXPECT_NEAR(statistics->estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 50), 0.25, 0.05);
+  EXPECT_NEAR(statistics->estimate_cardinality(ColumnID{0}, ScanType::OpGreaterThanEquals, 50), 150, 10);
+  EXPECT_NEAR(statistics->estimate_cardinality(ColumnID{0}, ScanType::OpEquals, 50), 1, 0.5);
+  EXPECT_DOUBLE_EQ(statistics->estimate_cardinality(ColumnID{1}, ScanType::OpEquals, "odd"), 100.0);
+  EXPECT_DOUBLE_EQ(statistics->estimate_cardinality(ColumnID{1}, ScanType::OpNotEquals, "odd"), 0.0);
+  EXPECT_THROW(statistics->column_statistics(ColumnID{2}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -1,5 +1,13 @@
 #include "base_test.hpp"
 
+#include "storage/alp_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/index/adaptive_radix_tree_index.hpp"
+#include "storage/index/composite_index.hpp"
+#include "storage/index/unique_hash_index.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -142,6 +150,69 @@ TEST_F(StorageTableTest, AppendWithEncodedSegments) {
   EXPECT_EQ(table.chunk_count(), 2);
 }
 
+TEST_F(StorageTableTest, CompressChunkWithEncoding) {
+  table.append({4, "Hello,"});
+  table.append({4, "world"});
+  table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<FrameOfReferenceSegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  // Strings cannot be frame-of-reference encoded and fall back to dictionary encoding.
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<std::string>>(chunk->get_segment(ColumnID{1})));
+
+  table.append({5, "!"});
+  table.compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(
+      table.get_chunk(ChunkID{1})->get_segment(ColumnID{0})));
+  EXPECT_EQ((*table.get_chunk(ChunkID{1})->get_segment(ColumnID{1}))[0], AllTypeVariant{"!"});
+}
+
+TEST_F(StorageTableTest, CompressChunkWithFSST) {
+  table.append({4, "Hello,"});
+  table.append({4, "world"});
+  table.compress_chunk(ChunkID{0}, EncodingType::FSST);
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  // Integers cannot be FSST-encoded and fall back to dictionary encoding.
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<FSSTSegment<std::string>>(chunk->get_segment(ColumnID{1})));
+  EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+}
+
+TEST_F(StorageTableTest, CompressChunkWithALP) {
+  table.add_column("col_3", "double", false);
+  table.append({4, "Hello,", 21.5});
+  table.append({4, "world", 22.25});
+  table.compress_chunk(ChunkID{0}, EncodingType::ALP);
+
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ALPSegment<double>>(chunk->get_segment(ColumnID{2})));
+  EXPECT_EQ((*chunk->get_segment(ColumnID{2}))[1], AllTypeVariant{22.25});
+}
+
+TEST_F(StorageTableTest, CompressChunkRebuildsIndexes) {
+  table.append({4, "Hello,"});
+  table.append({3, "world"});
+  table.get_chunk(ChunkID{0})->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  table.get_chunk(ChunkID{0})->create_index<CompositeIndex>({ColumnID{1}, ColumnID{0}});
+  table.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  // The indexes cover the compressed segments.
+  const auto chunk = table.get_chunk(ChunkID{0});
+  const auto art_indexes = chunk->get_indexes({ColumnID{0}});
+  ASSERT_EQ(art_indexes.size(), 1);
+  EXPECT_EQ(art_indexes.front()->type(), SegmentIndexType::AdaptiveRadixTree);
+  EXPECT_EQ(std::vector<ChunkOffset>(art_indexes.front()->cbegin(), art_indexes.front()->cend()),
+            (std::vector<ChunkOffset>{1, 0}));
+  const auto composite_indexes = chunk->get_indexes({ColumnID{1}, ColumnID{0}});
+  ASSERT_EQ(composite_indexes.size(), 1);
+  EXPECT_EQ(composite_indexes.front()->type(), SegmentIndexType::Composite);
+  EXPECT_EQ(composite_indexes.front()->get_indexed_segments(),
+            (std::vector<std::shared_ptr<const AbstractSegment>>{chunk->get_segment(ColumnID{1}),
+                                                                 chunk->get_segment(ColumnID{0})}));
+}
+
 TEST_F(StorageTableTest, CompressChunkTwice) {
   table.append({1, "foo"});
   EXPECT_EQ(table.row_count(), 1);
@@ -158,4 +229,65 @@ TEST_F(StorageTableTest, CompressInvalidId) {
   EXPECT_THROW(table.compress_chunk(ChunkID{1}), std::logic_error);
 }
 
+TEST_F(StorageTableTest, UniqueIndex) {
+  table.append({4, "Hello,"});
+  table.append({6, "world"});
+  table.add_unique_index(ColumnID{0});
+  EXPECT_THROW(table.add_unique_index(ColumnID{0}), std::logic_error);
+  EXPECT_FALSE(table.unique_index(ColumnID{1}));
+
+  const auto index = table.unique_index(ColumnID{0});
+  ASSERT_TRUE(index);
+  table.append({3, "!"});
+  EXPECT_EQ(index->size(), 3);
+  EXPECT_EQ(index->find(6), (RowID{ChunkID{0}, ChunkOffset{1}}));
+  EXPECT_EQ(index->find(3), (RowID{ChunkID{1}, ChunkOffset{0}}));
+  EXPECT_FALSE(index->find(5));
+  EXPECT_FALSE(index->find(NULL_VALUE));
+
+  // Compression keeps the positions of the rows.
+  table.compress_chunk(ChunkID{0});
+  EXPECT_EQ(index->find(6), (RowID{ChunkID{0}, ChunkOffset{1}}));
+  EXPECT_EQ((*table.get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[1], AllTypeVariant{"world"});
+
+  // Rows that violate the index are rejected without modifying the table.
+  EXPECT_THROW(table.append({6, "again"}), std::logic_error);
+  EXPECT_EQ(table.row_count(), 3);
+  EXPECT_EQ(index->size(), 3);
+}
+
+TEST_F(StorageTableTest, UniqueIndexesRejectChunk) {
+  auto keys = Table{};
+  keys.add_column("a", "int", false);
+  keys.add_column("b", "int", false);
+  keys.append({1, 10});
+  keys.add_unique_index(ColumnID{0});
+  keys.add_unique_index(ColumnID{1});
+
+  // The value of a is new, the one of b is a duplicate. Neither index must keep the rows of the rejected chunk.
+  const auto a_segment = std::make_shared<ValueSegment<int32_t>>(false);
+  a_segment->append(2);
+  const auto b_segment = std::make_shared<ValueSegment<int32_t>>(false);
+  b_segment->append(10);
+  const auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(a_segment);
+  chunk->add_segment(b_segment);
+  EXPECT_THROW(keys.emplace_chunk(chunk), std::logic_error);
+  EXPECT_EQ(keys.chunk_count(), 1);
+  EXPECT_FALSE(keys.unique_index(ColumnID{0})->contains(2));
+  EXPECT_EQ(keys.unique_index(ColumnID{0})->size(), 1);
+
+  keys.append({2, 20});
+  EXPECT_EQ(keys.unique_index(ColumnID{0})->find(2), (RowID{ChunkID{0}, ChunkOffset{1}}));
+}
+
+TEST_F(StorageTableTest, UniqueIndexOnInvalidColumn) {
+  table.append({4, "Hello,"});
+  table.append({5, NULL_VALUE});
+  table.append({6, "Hello,"});
+  EXPECT_THROW(table.add_unique_index(ColumnID{1}), std::logic_error);
+  EXPECT_FALSE(table.unique_index(ColumnID{1}));
+  EXPECT_THROW(table.add_unique_index(ColumnID{2}), std::logic_error);
+}
+
 }  // namespace opossum
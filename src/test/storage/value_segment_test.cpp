@@ -82,6 +82,17 @@ TEST_F(StorageValueSegmentTest, NullValueHandling) {
   EXPECT_THROW(string_value_segment.null_values(), std::logic_error);
 }
 
+TEST_F(StorageValueSegmentTest, HasNullValues) {
+  int_value_segment.append(1);
+  EXPECT_FALSE(int_value_segment.has_null_values());
+  int_value_segment.append(NULL_VALUE);
+  EXPECT_TRUE(int_value_segment.has_null_values());
+  EXPECT_EQ(int_value_segment.null_values().null_count(), 1);
+
+  string_value_segment.append("Test");
+  EXPECT_FALSE(string_value_segment.has_null_values());
+}
+
 TEST_F(StorageValueSegmentTest, GetTypedFromNonNullable) {
   string_value_segment.append("Test");
   EXPECT_EQ(string_value_segment.get_typed_value(ChunkOffset{0}), "Test");